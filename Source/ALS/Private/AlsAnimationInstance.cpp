@@ -16,11 +16,50 @@
 #include "Utility/AlsMontageUtility.h"
 #include "Utility/AlsPrivateMemberAccessor.h"
 #include "Utility/AlsRotation.h"
+#include "Utility/AlsSkeletalMeshData.h"
+#include "Utility/AlsStats.h"
+#include "Utility/AlsTrace.h"
 #include "Utility/AlsUtility.h"
 #include "Utility/AlsVector.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationInstance)
 
+namespace AlsAnimationInstance
+{
+	// Ground prediction is only performed while falling faster than this.
+	static constexpr auto GroundPredictionVerticalVelocityThreshold{-200.0f};
+
+	// Ground prediction treats this as the terminal velocity.
+	static constexpr auto GroundPredictionMinVerticalVelocity{-4000.0f};
+
+	// Checks all descendants, not only the direct children, since UPrimitiveComponent::MoveComponent() updates
+	// the overlaps of the whole attachment hierarchy, for example of a weapon attached to a holster component.
+	static bool DoesAnyDescendantGenerateOverlapEvents(const USceneComponent& Component)
+	{
+		for (const auto* Child : Component.GetAttachChildren())
+		{
+			if (!IsValid(Child))
+			{
+				continue;
+			}
+
+			const auto* Primitive{Cast<UPrimitiveComponent>(Child)};
+
+			if ((IsValid(Primitive) && Primitive->GetGenerateOverlapEvents()) || DoesAnyDescendantGenerateOverlapEvents(*Child))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	static bool HasFootBones(const FAlsSkeletalMeshData& SkeletalMeshData, const UAlsAnimationInstanceSettings& Settings)
+	{
+		return Settings.General.bUseFootIkBones ? SkeletalMeshData.HasFootIkBones() : SkeletalMeshData.HasFootVirtualBones();
+	}
+}
+
 ALS_DEFINE_PRIVATE_MEMBER_ACCESSOR(AlsGetAnimationCurvesAccessor, &FAnimInstanceProxy::GetAnimationCurves,
                                    const TMap<FName, float>& (FAnimInstanceProxy::*)(EAnimCurveType) const)
 
@@ -44,43 +83,14 @@ void UAlsAnimationInstance::NativeInitializeAnimation()
 
 	if (IsValid(Mesh) && IsValid(Mesh->GetSkinnedAsset()))
 	{
-		const auto& ReferenceSkeleton{Mesh->GetSkinnedAsset()->GetRefSkeleton()};
-		const auto PelvisBoneIndex{ReferenceSkeleton.FindBoneIndex(UAlsConstants::PelvisBoneName())};
+		SkeletalMeshData = FAlsSkeletalMeshData::Get(*Mesh->GetSkinnedAsset());
 
-		static const auto GetThighAxis{
-			[](const FReferenceSkeleton& ReferenceSkeleton, const int32 PelvisBoneIndex, const FName& FootBoneName, FVector3f& ThighAxis)
-			{
-				auto ParentBoneIndex{ReferenceSkeleton.FindBoneIndex(FootBoneName)};
-				if (ParentBoneIndex < 0)
-				{
-					return;
-				}
-
-				while (true)
-				{
-					const auto NextParentBoneIndex{ReferenceSkeleton.GetParentIndex(ParentBoneIndex)};
-					if (NextParentBoneIndex <= 0)
-					{
-						return;
-					}
-
-					if (NextParentBoneIndex == PelvisBoneIndex)
-					{
-						break;
-					}
-
-					ParentBoneIndex = NextParentBoneIndex;
-				}
-
-				const auto& ThighTransform{ReferenceSkeleton.GetRefBonePose()[ParentBoneIndex]};
-
-				ThighAxis = FVector3f{ThighTransform.GetLocation()};
-				ThighAxis.Normalize();
-			}
-		};
-
-		GetThighAxis(ReferenceSkeleton, PelvisBoneIndex, UAlsConstants::FootLeftBoneName(), FeetState.Left.ThighAxis);
-		GetThighAxis(ReferenceSkeleton, PelvisBoneIndex, UAlsConstants::FootRightBoneName(), FeetState.Right.ThighAxis);
+		FeetState.Left.ThighAxis = SkeletalMeshData->ThighLeftAxis;
+		FeetState.Right.ThighAxis = SkeletalMeshData->ThighRightAxis;
+	}
+	else
+	{
+		SkeletalMeshData.Reset();
 	}
 }
 
@@ -105,23 +115,7 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 		return;
 	}
 
-	auto* Mesh{GetSkelMeshComponent()};
-
-	if (Mesh->IsUsingAbsoluteRotation() && IsValid(Mesh->GetAttachParent()))
-	{
-		const auto& ParentTransform{Mesh->GetAttachParent()->GetComponentTransform()};
-
-		// Manually synchronize mesh rotation with character rotation.
-
-		Mesh->MoveComponent(FVector::ZeroVector, ParentTransform.GetRotation() * Character->GetBaseRotationOffset(), false);
-
-		// Re-cache proxy transforms to match the modified mesh transform.
-
-		const auto& Proxy{GetProxyOnGameThread<FAnimInstanceProxy>()};
-		const_cast<FTransform&>(Proxy.GetComponentTransform()) = Mesh->GetComponentTransform();
-		const_cast<FTransform&>(Proxy.GetComponentRelativeTransform()) = Mesh->GetRelativeTransform();
-		const_cast<FTransform&>(Proxy.GetActorTransform()) = Character->GetActorTransform();
-	}
+	RefreshMeshRotationOnGameThread();
 
 #if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
 	bDisplayDebugTraces = UAlsDebugUtility::ShouldDisplayDebugForActor(Character, UAlsConstants::TracesDebugDisplayName());
@@ -157,6 +151,56 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 	}
 }
 
+void UAlsAnimationInstance::RefreshMeshRotationOnGameThread() const
+{
+	check(IsInGameThread())
+
+	auto* Mesh{GetSkelMeshComponent()};
+
+	if (!Mesh->IsUsingAbsoluteRotation() || !IsValid(Mesh->GetAttachParent()))
+	{
+		return;
+	}
+
+	// Manually synchronize mesh rotation with character rotation.
+
+	const auto NewRotation{Mesh->GetAttachParent()->GetComponentQuat() * Character->GetBaseRotationOffset()};
+
+	if (Mesh->GetComponentQuat().Equals(NewRotation, UE_SMALL_NUMBER))
+	{
+		// The proxy transforms were cached from the current mesh transform, so there is nothing to update.
+
+		INC_DWORD_STAT(STAT_Als_MeshRotationSyncsSkipped);
+		return;
+	}
+
+	// UPrimitiveComponent::MoveComponent() is only needed if the mesh or any of its attached components generate
+	// overlap events, since it updates overlaps after the move. Otherwise, it is enough to set the relative rotation
+	// (which is the world rotation when using absolute rotation) and update the component transform, which still
+	// updates the kinematic bodies, the render transform and the transforms of the attached components.
+
+	if (Mesh->GetGenerateOverlapEvents() || AlsAnimationInstance::DoesAnyDescendantGenerateOverlapEvents(*Mesh))
+	{
+		INC_DWORD_STAT(STAT_Als_MeshRotationSyncsFull);
+
+		Mesh->MoveComponent(FVector::ZeroVector, NewRotation, false);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_Als_MeshRotationSyncsLightweight);
+
+		Mesh->SetRelativeRotation_Direct(Mesh->GetRelativeRotationCache().QuatToRotator(NewRotation));
+		Mesh->UpdateComponentToWorld();
+	}
+
+	// Re-cache proxy transforms to match the modified mesh transform.
+
+	const auto& Proxy{GetProxyOnGameThread<FAnimInstanceProxy>()};
+	const_cast<FTransform&>(Proxy.GetComponentTransform()) = Mesh->GetComponentTransform();
+	const_cast<FTransform&>(Proxy.GetComponentRelativeTransform()) = Mesh->GetRelativeTransform();
+	const_cast<FTransform&>(Proxy.GetActorTransform()) = Character->GetActorTransform();
+}
+
 void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTime)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::NativeThreadSafeUpdateAnimation"),
@@ -199,6 +243,8 @@ void UAlsAnimationInstance::NativePostUpdateAnimation()
 	PlayQueuedTurnInPlaceAnimation();
 	StopQueuedTransitionAndTurnInPlaceAnimations();
 
+	TRACE_ALS_ANIMATION_STATE(*this, *Character, LayeringState, FeetState)
+
 #if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
 	if (!bPendingUpdate)
 	{
@@ -214,6 +260,59 @@ void UAlsAnimationInstance::NativePostUpdateAnimation()
 	bPendingUpdate = false;
 }
 
+void UAlsAnimationInstance::ResetState()
+{
+	StopAllMontages(0.0f);
+
+	// Getting the proxy on the game thread also waits for the parallel animation evaluation to complete.
+
+	GetProxyOnGameThread<FAlsAnimationInstanceProxy>().ResetGraph();
+
+	const auto* DefaultAnimationInstance{GetClass()->GetDefaultObject<ThisClass>()};
+
+	TeleportedTime = 0.0f;
+
+	ViewMode = DefaultAnimationInstance->ViewMode;
+	LocomotionMode = DefaultAnimationInstance->LocomotionMode;
+	RotationMode = DefaultAnimationInstance->RotationMode;
+	Stance = DefaultAnimationInstance->Stance;
+	Gait = DefaultAnimationInstance->Gait;
+	OverlayMode = DefaultAnimationInstance->OverlayMode;
+	LocomotionAction = DefaultAnimationInstance->LocomotionAction;
+	GroundedEntryMode = DefaultAnimationInstance->GroundedEntryMode;
+
+	MovementBase = {};
+	LayeringState = {};
+	PoseState = {};
+	ViewState = {};
+	SpineState = {};
+	HeadState = {};
+	LocomotionState = {};
+	LeanState = {};
+	GroundedState = {};
+	StandingState = {};
+	CrouchingState = {};
+	ProningState = {};
+	InAirState = {};
+	BallisticGroundPrediction = {};
+	FeetState = {};
+	TransitionsState = {};
+	DynamicTransitionsState = {};
+	RotateInPlaceState = {};
+	TurnInPlaceState = {};
+	RagdollingState = {};
+
+	if (SkeletalMeshData.IsValid())
+	{
+		FeetState.Left.ThighAxis = SkeletalMeshData->ThighLeftAxis;
+		FeetState.Right.ThighAxis = SkeletalMeshData->ThighRightAxis;
+	}
+
+	// Values that depend on the previous frame, such as the foot lock locations, are re-initialized on the next update.
+
+	MarkPendingUpdate();
+}
+
 FAnimInstanceProxy* UAlsAnimationInstance::CreateAnimInstanceProxy()
 {
 	return new FAlsAnimationInstanceProxy{this};
@@ -695,9 +794,21 @@ void UAlsAnimationInstance::RefreshLocomotionOnGameThread()
 	LocomotionState.Velocity = Locomotion.Velocity;
 	LocomotionState.VelocityYawAngle = Locomotion.VelocityYawAngle;
 
-	LocomotionState.Acceleration = bCanCalculateRateOfChange
-		                               ? (LocomotionState.Velocity - PreviousVelocity) / ActorDeltaTime
-		                               : FVector::ZeroVector;
+	const auto& VelocityNetworkSmoothing{Character->GetVelocityNetworkSmoothing()};
+
+	if (VelocityNetworkSmoothing.bEnabled)
+	{
+		// The rate of change of the smoothed velocity is still discontinuous at network updates, so use the acceleration
+		// that is smoothed together with it, otherwise the leans would twitch on each update.
+
+		LocomotionState.Acceleration = VelocityNetworkSmoothing.CurrentAcceleration;
+	}
+	else
+	{
+		LocomotionState.Acceleration = bCanCalculateRateOfChange
+			                               ? (LocomotionState.Velocity - PreviousVelocity) / ActorDeltaTime
+			                               : FVector::ZeroVector;
+	}
 
 	const auto* Movement{Character->GetCharacterMovement()};
 
@@ -1113,6 +1224,148 @@ void UAlsAnimationInstance::RefreshInAirOnGameThread()
 
 	InAirState.bJumped = !bPendingUpdate && (InAirState.bJumped || InAirState.bJumpRequested);
 	InAirState.bJumpRequested = false;
+
+	RefreshBallisticGroundPredictionOnGameThread();
+}
+
+void UAlsAnimationInstance::RefreshBallisticGroundPredictionOnGameThread()
+{
+	auto& Prediction{BallisticGroundPrediction};
+
+	if (!Settings->InAir.bUseBallisticGroundPrediction || LocomotionMode != AlsLocomotionModeTags::InAir ||
+	    LocomotionState.Velocity.Z > AlsAnimationInstance::GroundPredictionVerticalVelocityThreshold)
+	{
+		Prediction.Reset();
+		return;
+	}
+
+	// Don't start sweeps whose results won't be used, since RefreshGroundPrediction() ignores
+	// the prediction while the ground prediction is blocked by the animation curve.
+
+	if (GetCurveValueClamped01(UAlsConstants::GroundPredictionBlockCurveName()) >= 1.0f - UE_KINDA_SMALL_NUMBER)
+	{
+		Prediction.Reset();
+		return;
+	}
+
+	const auto* World{GetWorld()};
+
+	if (Prediction.bValid)
+	{
+		// Predict the trajectory again if the character deviates from it, for example, due to air control
+		// or a collision, or if the surface on which the character is expected to land has moved.
+
+		const auto Time{World->GetTimeSeconds() - Prediction.StartTime};
+		const auto LocationToleranceSquared{FMath::Square(Settings->InAir.BallisticGroundPredictionLocationTolerance)};
+
+		if (FVector::DistSquared(LocomotionState.Velocity, Prediction.GetVelocity(Time)) >
+		    FMath::Square(Settings->InAir.BallisticGroundPredictionVelocityTolerance) ||
+		    FVector::DistSquared(LocomotionState.Location, Prediction.GetLocation(Time)) > LocationToleranceSquared ||
+		    (Prediction.bGroundFound && (!Prediction.LandingPrimitive.IsValid() ||
+		                                 FVector::DistSquared(Prediction.LandingPrimitive->GetComponentLocation(),
+		                                                      Prediction.LandingPrimitiveLocation) > LocationToleranceSquared)))
+		{
+			Prediction.Reset();
+		}
+	}
+
+	if (!Prediction.bValid)
+	{
+		StartBallisticGroundPrediction();
+		return;
+	}
+
+	// Process the completed sweeps in trajectory order until something is hit.
+
+	while (!Prediction.SweepHandles.IsEmpty())
+	{
+		FTraceDatum TraceDatum;
+		if (!World->QueryTraceData(Prediction.SweepHandles[0], TraceDatum))
+		{
+			if (!World->IsTraceHandleValid(Prediction.SweepHandles[0], false))
+			{
+				// The sweep results are only kept for one frame, so they can be lost if
+				// the animation instance has not been updated in time. Start over.
+
+				StartBallisticGroundPrediction();
+			}
+
+			return;
+		}
+
+		Prediction.SweepHandles.RemoveAt(0, EAllowShrinking::No);
+
+		const auto* Hit{TraceDatum.OutHits.FindByPredicate([](const FHitResult& OutHit) { return OutHit.bBlockingHit; })};
+
+		// Consider the ground valid, even if the sweep started in penetration.
+
+		const auto bGroundValid{Hit != nullptr && Hit->ImpactNormal.Z >= LocomotionState.WalkableFloorAngleCos};
+
+#if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
+		if (bDisplayDebugTraces)
+		{
+			UAlsDebugUtility::DrawSweepSingleCapsule(World, TraceDatum.Start, TraceDatum.End, FRotator::ZeroRotator,
+			                                         LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight,
+			                                         bGroundValid, Hit != nullptr ? *Hit : FHitResult{},
+			                                         {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f}, 0.5f);
+		}
+#endif
+
+		if (Hit != nullptr)
+		{
+			// The trajectory ends here, so the remaining sweeps are no longer needed.
+
+			Prediction.SweepHandles.Reset();
+
+			Prediction.bGroundFound = bGroundValid;
+			Prediction.LandingLocation = Hit->Location;
+			Prediction.LandingPrimitive = Hit->GetComponent();
+
+			if (Prediction.LandingPrimitive.IsValid())
+			{
+				Prediction.LandingPrimitiveLocation = Prediction.LandingPrimitive->GetComponentLocation();
+			}
+
+			return;
+		}
+	}
+}
+
+void UAlsAnimationInstance::StartBallisticGroundPrediction()
+{
+	auto& Prediction{BallisticGroundPrediction};
+	auto* World{GetWorld()};
+
+	Prediction.Reset();
+
+	Prediction.bValid = true;
+	Prediction.StartLocation = LocomotionState.Location;
+	Prediction.StartVelocity = LocomotionState.Velocity;
+	Prediction.GravityZ = Character->GetCharacterMovement()->GetGravityZ();
+	Prediction.MinVerticalVelocity = AlsAnimationInstance::GroundPredictionMinVerticalVelocity;
+	Prediction.StartTime = World->GetTimeSeconds();
+
+	const auto CapsuleShape{FCollisionShape::MakeCapsule(LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight)};
+	const FCollisionQueryParams QueryParameters{SCENE_QUERY_STAT(AlsBallisticGroundPrediction), false, Character};
+	const FCollisionResponseParams ResponseParameters{Settings->InAir.GroundPredictionSweepResponses};
+
+	const auto SweepsCount{FMath::Max(1, Settings->InAir.BallisticGroundPredictionSweepsCount)};
+	const auto SweepTime{Settings->InAir.BallisticGroundPredictionMaxTime / static_cast<float>(SweepsCount)};
+
+	auto SweepStartLocation{Prediction.StartLocation};
+
+	ALS_COUNT_SCENE_QUERIES(Character, STAT_Als_GroundPredictionSceneQueries, GroundPrediction, SweepsCount);
+
+	for (auto i{1}; i <= SweepsCount; i++)
+	{
+		const auto SweepEndLocation{Prediction.GetLocation(SweepTime * i)};
+
+		Prediction.SweepHandles.Emplace(World->AsyncSweepByChannel(EAsyncTraceType::Single, SweepStartLocation, SweepEndLocation,
+		                                                           FQuat::Identity, Settings->InAir.GroundPredictionSweepChannel,
+		                                                           CapsuleShape, QueryParameters, ResponseParameters));
+
+		SweepStartLocation = SweepEndLocation;
+	}
 }
 
 void UAlsAnimationInstance::RefreshInAir()
@@ -1156,9 +1409,7 @@ void UAlsAnimationInstance::RefreshGroundPrediction()
 	// is falling toward and getting the "time" (range from 0 to 1, 1 being maximum, 0 being about to ground) till impact.
 	// The ground prediction amount curve is used to control how the time affects the final amount for a smooth blend.
 
-	static constexpr auto VerticalVelocityThreshold{-200.0f};
-
-	if (InAirState.VerticalVelocity > VerticalVelocityThreshold)
+	if (InAirState.VerticalVelocity > AlsAnimationInstance::GroundPredictionVerticalVelocityThreshold)
 	{
 		InAirState.GroundPredictionAmount = 0.0f;
 		return;
@@ -1171,23 +1422,46 @@ void UAlsAnimationInstance::RefreshGroundPrediction()
 		return;
 	}
 
-	const auto SweepStartLocation{LocomotionState.Location};
+	static constexpr auto MinVerticalVelocity{AlsAnimationInstance::GroundPredictionMinVerticalVelocity};
+	static constexpr auto MaxVerticalVelocity{AlsAnimationInstance::GroundPredictionVerticalVelocityThreshold};
+
+	static constexpr auto MinSweepDistance{150.0f};
+	static constexpr auto MaxSweepDistance{2000.0f};
+
+	const auto SweepDistance{
+		FMath::GetMappedRangeValueClamped(FVector2f{MaxVerticalVelocity, MinVerticalVelocity},
+		                                  {MinSweepDistance, MaxSweepDistance},
+		                                  InAirState.VerticalVelocity) * LocomotionState.Scale
+	};
+
+	if (Settings->InAir.bUseBallisticGroundPrediction)
+	{
+		// Use the landing location found on the game thread instead of sweeping, and convert the
+		// remaining distance to it into the same "time" that the velocity direction sweep would give.
 
-	static constexpr auto MinVerticalVelocity{-4000.0f};
-	static constexpr auto MaxVerticalVelocity{-200.0f};
+		const auto& Prediction{BallisticGroundPrediction};
+
+		const auto Time{
+			Prediction.bGroundFound && SweepDistance > UE_KINDA_SMALL_NUMBER
+				? UE_REAL_TO_FLOAT(FVector::Dist(LocomotionState.Location, Prediction.LandingLocation)) / SweepDistance
+				: 2.0f
+		};
+
+		InAirState.GroundPredictionAmount = Time <= 1.0f
+			                                    ? Settings->InAir.GroundPredictionAmountCurve->GetFloatValue(Time) * AllowanceAmount
+			                                    : 0.0f;
+		return;
+	}
+
+	const auto SweepStartLocation{LocomotionState.Location};
 
 	auto VelocityDirection{LocomotionState.Velocity};
 	VelocityDirection.Z = FMath::Clamp(VelocityDirection.Z, MinVerticalVelocity, MaxVerticalVelocity);
 	VelocityDirection.Normalize();
 
-	static constexpr auto MinSweepDistance{150.0f};
-	static constexpr auto MaxSweepDistance{2000.0f};
+	const auto SweepVector{VelocityDirection * SweepDistance};
 
-	const auto SweepVector{
-		VelocityDirection * FMath::GetMappedRangeValueClamped(FVector2f{MaxVerticalVelocity, MinVerticalVelocity},
-		                                                      {MinSweepDistance, MaxSweepDistance},
-		                                                      InAirState.VerticalVelocity) * LocomotionState.Scale
-	};
+	ALS_COUNT_SCENE_QUERY(Character, STAT_Als_GroundPredictionSceneQueries, GroundPrediction);
 
 	FHitResult Hit;
 	GetWorld()->SweepSingleByChannel(Hit, SweepStartLocation, SweepStartLocation + SweepVector,
@@ -1258,25 +1532,48 @@ void UAlsAnimationInstance::RefreshFeetOnGameThread()
 
 	const auto* Mesh{GetSkelMeshComponent()};
 
-	FeetState.PelvisRotation = FQuat4f{Mesh->GetSocketTransform(UAlsConstants::PelvisBoneName(), RTS_Component).GetRotation()};
+	if (!SkeletalMeshData.IsValid() || !IsValid(Mesh))
+	{
+		return;
+	}
+
+	// Copy the targets from the mesh pose of the previous evaluation, which is the same pose that
+	// USkinnedMeshComponent::GetSocketTransform() uses. If a bone is not available, for example
+	// until the leader pose component is evaluated for the first time, keep the previous targets.
 
-	const auto FootLeftTargetTransform{
-		Mesh->GetSocketTransform(Settings->General.bUseFootIkBones
-			                         ? UAlsConstants::FootLeftIkBoneName()
-			                         : UAlsConstants::FootLeftVirtualBoneName())
-	};
+	FTransform PelvisTransform;
+	if (UAlsUtility::TryGetComponentSpaceBoneTransform(*Mesh, SkeletalMeshData->PelvisBoneIndex, PelvisTransform))
+	{
+		FeetState.PelvisRotation = FQuat4f{PelvisTransform.GetRotation()};
+	}
+
+	if (!AlsAnimationInstance::HasFootBones(*SkeletalMeshData, *Settings))
+	{
+		return;
+	}
+
+	UAlsUtility::TryGetComponentSpaceBoneTransform(*Mesh, Settings->General.bUseFootIkBones
+		                                                      ? SkeletalMeshData->FootLeftIkBoneIndex
+		                                                      : SkeletalMeshData->FootLeftVirtualBoneIndex,
+	                                               FootLeftTargetComponentTransform);
+
+	UAlsUtility::TryGetComponentSpaceBoneTransform(*Mesh, Settings->General.bUseFootIkBones
+		                                                      ? SkeletalMeshData->FootRightIkBoneIndex
+		                                                      : SkeletalMeshData->FootRightVirtualBoneIndex,
+	                                               FootRightTargetComponentTransform);
+}
+
+void UAlsAnimationInstance::RefreshFeetTargets(const FTransform& ComponentTransform)
+{
+	const auto FootLeftTargetTransform{FootLeftTargetComponentTransform * ComponentTransform};
 
 	FeetState.Left.TargetLocation = FootLeftTargetTransform.GetLocation();
-	FeetState.Left.TargetRotation = FootLeftTargetTransform.GetRotation();
+	FeetState.Left.TargetRotation = FQuat4f{FootLeftTargetTransform.GetRotation()};
 
-	const auto FootRightTargetTransform{
-		Mesh->GetSocketTransform(Settings->General.bUseFootIkBones
-			                         ? UAlsConstants::FootRightIkBoneName()
-			                         : UAlsConstants::FootRightVirtualBoneName())
-	};
+	const auto FootRightTargetTransform{FootRightTargetComponentTransform * ComponentTransform};
 
 	FeetState.Right.TargetLocation = FootRightTargetTransform.GetLocation();
-	FeetState.Right.TargetRotation = FootRightTargetTransform.GetRotation();
+	FeetState.Right.TargetRotation = FQuat4f{FootRightTargetTransform.GetRotation()};
 }
 
 void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
@@ -1284,8 +1581,18 @@ void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 	FeetState.FootPlantedAmount = FMath::Clamp(GetCurveValue(UAlsConstants::FootPlantedCurveName()), -1.0f, 1.0f);
 	FeetState.FeetCrossingAmount = GetCurveValueClamped01(UAlsConstants::FeetCrossingCurveName());
 
+	// Without the foot bones selected by the settings there are no feet targets, so foot
+	// locking is skipped instead of locking the feet to the default targets at the mesh origin.
+
+	if (!SkeletalMeshData.IsValid() || !AlsAnimationInstance::HasFootBones(*SkeletalMeshData, *Settings))
+	{
+		return;
+	}
+
 	const auto ComponentTransform{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform()};
 
+	RefreshFeetTargets(ComponentTransform);
+
 	FAlsFootUpdateContext Context{
 		.ComponentTransform{ComponentTransform},
 		.ComponentTransformInverse{ComponentTransform.Inverse()},
@@ -1324,7 +1631,7 @@ void UAlsAnimationInstance::ProcessFootLockTeleport(const FAlsFootUpdateContext&
 	}
 
 	FootState.LockLocation = Context.ComponentTransform.TransformPosition(FVector{FootState.LockComponentRelativeLocation});
-	FootState.LockRotation = Context.ComponentTransform.TransformRotation(FQuat{FootState.LockComponentRelativeRotation});
+	FootState.LockRotation = FQuat4f{Context.ComponentTransform.TransformRotation(FQuat{FootState.LockComponentRelativeRotation})};
 
 	if (MovementBase.bHasRelativeLocation)
 	{
@@ -1333,7 +1640,7 @@ void UAlsAnimationInstance::ProcessFootLockTeleport(const FAlsFootUpdateContext&
 		FootState.LockMovementBaseRelativeLocation =
 			FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocation - MovementBase.Location)};
 
-		FootState.LockMovementBaseRelativeRotation = FQuat4f{BaseRotationInverse * FootState.LockRotation};
+		FootState.LockMovementBaseRelativeRotation = FQuat4f{BaseRotationInverse * FQuat{FootState.LockRotation}};
 	}
 }
 
@@ -1354,7 +1661,7 @@ void UAlsAnimationInstance::ProcessFootLockBaseChange(const FAlsFootUpdateContex
 	}
 
 	FootState.LockComponentRelativeLocation = FVector3f{Context.ComponentTransformInverse.TransformPosition(FootState.LockLocation)};
-	FootState.LockComponentRelativeRotation = FQuat4f{Context.ComponentTransformInverse.TransformRotation(FootState.LockRotation)};
+	FootState.LockComponentRelativeRotation = FQuat4f{Context.ComponentTransformInverse.TransformRotation(FQuat{FootState.LockRotation})};
 
 	if (MovementBase.bHasRelativeLocation)
 	{
@@ -1363,7 +1670,7 @@ void UAlsAnimationInstance::ProcessFootLockBaseChange(const FAlsFootUpdateContex
 		FootState.LockMovementBaseRelativeLocation =
 			FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocation - MovementBase.Location)};
 
-		FootState.LockMovementBaseRelativeRotation = FQuat4f{BaseRotationInverse * FootState.LockRotation};
+		FootState.LockMovementBaseRelativeRotation = FQuat4f{BaseRotationInverse * FQuat{FootState.LockRotation}};
 	}
 	else
 	{
@@ -1400,7 +1707,7 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 			FootState.LockAmount = 0.0f;
 
 			FootState.LockLocation = FVector::ZeroVector;
-			FootState.LockRotation = FQuat::Identity;
+			FootState.LockRotation = FQuat4f::Identity;
 
 			FootState.LockComponentRelativeLocation = FVector3f::ZeroVector;
 			FootState.LockComponentRelativeRotation = FQuat4f::Identity;
@@ -1410,7 +1717,7 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 		}
 
 		FootState.FinalLocation = FVector3f{Context.ComponentTransformInverse.TransformPosition(FootState.TargetLocation)};
-		FootState.FinalRotation = FQuat4f{Context.ComponentTransformInverse.TransformRotation(FootState.TargetRotation)};
+		FootState.FinalRotation = FQuat4f{Context.ComponentTransformInverse.TransformRotation(FQuat{FootState.TargetRotation})};
 		return;
 	}
 
@@ -1432,7 +1739,7 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 			if (bPendingUpdate)
 			{
 				TargetLocation = FootState.TargetLocation;
-				TargetRotation = FootState.TargetRotation;
+				TargetRotation = FQuat{FootState.TargetRotation};
 			}
 			else
 			{
@@ -1449,13 +1756,13 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 				// amount is close to 1 to get rid of the foot "teleportation" issue.
 
 				FootState.LockLocation = TargetLocation;
-				FootState.LockRotation = TargetRotation;
+				FootState.LockRotation = FQuat4f{TargetRotation};
 
 				FootState.LockComponentRelativeLocation =
 					FVector3f{Context.ComponentTransformInverse.TransformPosition(FootState.LockLocation)};
 
 				FootState.LockComponentRelativeRotation =
-					FQuat4f{Context.ComponentTransformInverse.TransformRotation(FootState.LockRotation)};
+					FQuat4f{Context.ComponentTransformInverse.TransformRotation(FQuat{FootState.LockRotation})};
 			}
 
 			if (MovementBase.bHasRelativeLocation)
@@ -1481,16 +1788,21 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 		FootState.LockAmount = NewLockAmount;
 	}
 
+	// The lock rotation is kept in double precision until the end of the function, so that
+	// it is converted from and to single precision only once instead of after every step.
+
+	auto LockRotation{FQuat{FootState.LockRotation}};
+
 	if (MovementBase.bHasRelativeLocation)
 	{
 		FootState.LockLocation = MovementBase.Location +
 		                         MovementBase.Rotation.RotateVector(FVector{FootState.LockMovementBaseRelativeLocation});
 
-		FootState.LockRotation = MovementBase.Rotation * FQuat{FootState.LockMovementBaseRelativeRotation};
+		LockRotation = MovementBase.Rotation * FQuat{FootState.LockMovementBaseRelativeRotation};
 	}
 
 	FootState.LockComponentRelativeLocation = FVector3f{Context.ComponentTransformInverse.TransformPosition(FootState.LockLocation)};
-	FootState.LockComponentRelativeRotation = FQuat4f{Context.ComponentTransformInverse.TransformRotation(FootState.LockRotation)};
+	FootState.LockComponentRelativeRotation = FQuat4f{Context.ComponentTransformInverse.TransformRotation(LockRotation)};
 
 	// Limit the foot lock location so that legs do not twist into a spiral when the actor rotates quickly.
 
@@ -1509,7 +1821,7 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 		const auto& ComponentTransform{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform()};
 
 		FootState.LockLocation = ComponentTransform.TransformPosition(FVector{FootState.LockComponentRelativeLocation});
-		FootState.LockRotation = ComponentTransform.TransformRotation(FQuat{FootState.LockComponentRelativeRotation});
+		LockRotation = ComponentTransform.TransformRotation(FQuat{FootState.LockComponentRelativeRotation});
 
 		if (MovementBase.bHasRelativeLocation)
 		{
@@ -1518,13 +1830,15 @@ void UAlsAnimationInstance::RefreshFootLock(const FAlsFootUpdateContext& Context
 			FootState.LockMovementBaseRelativeLocation =
 				FVector3f{BaseRotationInverse.RotateVector(FootState.LockLocation - MovementBase.Location)};
 
-			FootState.LockMovementBaseRelativeRotation = FQuat4f{BaseRotationInverse * FootState.LockRotation};
+			FootState.LockMovementBaseRelativeRotation = FQuat4f{BaseRotationInverse * LockRotation};
 		}
 	}
 
+	FootState.LockRotation = FQuat4f{LockRotation};
+
 	const auto FinalLocation{FMath::Lerp(FootState.TargetLocation, FootState.LockLocation, FootState.LockAmount)};
 
-	auto FinalRotation{FQuat::FastLerp(FootState.TargetRotation, FootState.LockRotation, FootState.LockAmount)};
+	auto FinalRotation{FQuat::FastLerp(FQuat{FootState.TargetRotation}, LockRotation, FootState.LockAmount)};
 	FinalRotation.Normalize();
 
 	FootState.FinalLocation = FVector3f{Context.ComponentTransformInverse.TransformPosition(FinalLocation)};
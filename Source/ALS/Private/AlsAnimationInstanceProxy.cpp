@@ -6,6 +6,11 @@
 
 FAlsAnimationInstanceProxy::FAlsAnimationInstanceProxy(UAnimInstance* AnimationInstance) : FAnimInstanceProxy{AnimationInstance} {}
 
+void FAlsAnimationInstanceProxy::ResetGraph()
+{
+	InitializeRootNode();
+}
+
 void FAlsAnimationInstanceProxy::PostUpdate(UAnimInstance* AnimationInstance) const
 {
 	FAnimInstanceProxy::PostUpdate(AnimationInstance);
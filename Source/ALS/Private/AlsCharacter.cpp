@@ -6,6 +6,8 @@
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Curves/CurveFloat.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "GameFramework/GameNetworkManager.h"
 #include "GameFramework/PlayerController.h"
 #include "Net/UnrealNetwork.h"
@@ -14,6 +16,8 @@
 #include "Utility/AlsConstants.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsRotation.h"
+#include "Utility/AlsStats.h"
+#include "Utility/AlsTrace.h"
 #include "Utility/AlsUtility.h"
 #include "Utility/AlsVector.h"
 
@@ -43,12 +47,10 @@ AAlsCharacter::AAlsCharacter(const FObjectInitializer& ObjectInitializer) : Supe
 		GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
 		GetMesh()->bEnableUpdateRateOptimizations = false;
 
-		// Improves performance, but velocities of kinematic physical bodies will not be
-		// calculated, so the ragdoll will not inherit the actor's velocity when activated.
-
-		// TODO Wait until the FPhysScene_Chaos::UpdateKinematicsOnDeferredSkelMeshes() function will be fixed in future engine versions.
-
-		// GetMesh()->bDeferKinematicBoneUpdate = true;
+		// Enabling USkeletalMeshComponent::bDeferKinematicBoneUpdate improves performance, but velocities of kinematic
+		// physical bodies will not be calculated. It is supported, since the character velocity is manually passed to
+		// the ragdoll when it is activated, but it is left disabled by default until the
+		// FPhysScene_Chaos::UpdateKinematicsOnDeferredSkelMeshes() function will be fixed in future engine versions.
 	}
 
 	AlsCharacterMovement = Cast<UAlsCharacterMovementComponent>(GetCharacterMovement());
@@ -95,6 +97,10 @@ void AAlsCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
 	DOREPLIFETIME_WITH_PARAMS_FAST(AAlsCharacter, DesiredVelocityYawAngle, Parameters);
 	DOREPLIFETIME_WITH_PARAMS_FAST(AAlsCharacter, RagdollTargetLocation, Parameters);
 
+	Parameters.Condition = COND_None;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AAlsCharacter, RagdollPose, Parameters);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AAlsCharacter, ReuseCount, Parameters);
+
 	DOREPLIFETIME_CONDITION(AAlsCharacter, bIsProned, COND_SimulatedOnly);
 }
 
@@ -179,6 +185,11 @@ void AAlsCharacter::BeginPlay()
 	ViewState.NetworkSmoothing.bEnabled |= IsValid(Settings) &&
 		Settings->View.bEnableNetworkSmoothing && GetLocalRole() == ROLE_SimulatedProxy;
 
+	VelocityNetworkSmoothing.bEnabled = IsValid(Settings) &&
+		Settings->bEnableVelocityNetworkSmoothing && GetLocalRole() == ROLE_SimulatedProxy;
+
+	VelocityNetworkSmoothing.Snap(GetReplicatedServerLastTransformUpdateTimeStamp(), GetVelocity(), InputDirection);
+
 	// Update states to use the initial desired values.
 
 	ApplyDesiredStance();
@@ -191,7 +202,113 @@ void AAlsCharacter::BeginPlay()
 
 	AlsCharacterMovement->SetRotationMode(RotationMode);
 
+	if (IsValid(Settings))
+	{
+		for (const auto& OverlayModeToPreload : Settings->Overlay.PreloadedOverlayModes)
+		{
+			PreloadOverlayLayer(OverlayModeToPreload);
+		}
+	}
+
+	RefreshOverlayLayer();
+
 	OnOverlayModeChanged(OverlayMode);
+
+	StartPoseHistoryRecording();
+}
+
+void AAlsCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopPoseHistoryRecording();
+
+	if (OverlayLayerLoadHandle.IsValid())
+	{
+		OverlayLayerLoadHandle->CancelHandle();
+		OverlayLayerLoadHandle.Reset();
+	}
+
+	OverlayLayerPreloadHandles.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAlsCharacter::ResetForReuse()
+{
+	ResetLocalStateForReuse();
+
+	AlsCharacterMovement->ResetForReuse();
+
+	// Restore the desired state from the class defaults.
+
+	const auto* DefaultCharacter{GetClass()->GetDefaultObject<ThisClass>()};
+
+	SetViewMode(DefaultCharacter->ViewMode);
+	SetDesiredAiming(DefaultCharacter->bDesiredAiming);
+	SetDesiredRotationMode(DefaultCharacter->DesiredRotationMode);
+	SetDesiredStance(DefaultCharacter->DesiredStance);
+	SetDesiredGait(DefaultCharacter->DesiredGait);
+	SetOverlayMode(DefaultCharacter->OverlayMode);
+
+	InputDirection = FVector::ZeroVector;
+	DesiredVelocityYawAngle = 0.0f;
+	RagdollTargetLocation = FVector::ZeroVector;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(AAlsCharacter, InputDirection, this)
+	MARK_PROPERTY_DIRTY_FROM_NAME(AAlsCharacter, DesiredVelocityYawAngle, this)
+	MARK_PROPERTY_DIRTY_FROM_NAME(AAlsCharacter, RagdollTargetLocation, this)
+
+	ReuseCount += 1;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(AAlsCharacter, ReuseCount, this)
+
+	ApplyDesiredStance();
+	RefreshGait();
+	RefreshRotationMode();
+}
+
+void AAlsCharacter::ResetLocalStateForReuse()
+{
+	if (LocomotionAction == AlsLocomotionActionTags::Ragdolling)
+	{
+		StopRagdollingImplementation();
+	}
+
+	StopMantling();
+
+	if (AnimationInstance.IsValid())
+	{
+		AnimationInstance->ResetState();
+		AnimationInstance->MarkTeleported();
+	}
+
+	SetLocomotionAction(FGameplayTag::EmptyTag);
+
+	MovementBase = {};
+	bHasDesiredVelocity = false;
+	LocomotionState = {};
+	MantlingState = {};
+	RagdollingState = {};
+	RollingState = {};
+	FixedLogicAccumulatedTime = 0.0f;
+
+	// Network smoothing is enabled depending on the role, which doesn't change on reuse.
+
+	const auto bViewNetworkSmoothingEnabled{ViewState.NetworkSmoothing.bEnabled};
+
+	ViewState = {};
+	ViewState.NetworkSmoothing.bEnabled = bViewNetworkSmoothingEnabled;
+
+	const auto bVelocityNetworkSmoothingEnabled{VelocityNetworkSmoothing.bEnabled};
+
+	VelocityNetworkSmoothing = {};
+	VelocityNetworkSmoothing.bEnabled = bVelocityNetworkSmoothingEnabled;
+
+	PoseHistory.Clear();
+}
+
+void AAlsCharacter::OnReplicated_ReuseCount()
+{
+	ResetLocalStateForReuse();
 }
 
 void AAlsCharacter::CalcCamera(const float DeltaTime, FMinimalViewInfo& ViewInfo)
@@ -237,6 +354,13 @@ void AAlsCharacter::PostNetReceiveLocationAndRotation()
 	}
 }
 
+void AAlsCharacter::PostNetReceiveVelocity(const FVector& NewVelocity)
+{
+	Super::PostNetReceiveVelocity(NewVelocity);
+
+	CorrectVelocityNetworkSmoothing(NewVelocity);
+}
+
 void AAlsCharacter::OnRep_ReplicatedBasedMovement()
 {
 	// ACharacter::OnRep_ReplicatedBasedMovement() is only called on simulated proxies, so there is no need to check roles here.
@@ -319,6 +443,7 @@ void AAlsCharacter::OnRep_IsCrouched()
 void AAlsCharacter::Tick(const float DeltaTime)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::Tick"), STAT_AAlsCharacter_Tick, STATGROUP_Als)
+	CSV_SCOPED_TIMING_STAT(AlsCharacter, Tick);
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
 	if (!IsValid(Settings) || !AnimationInstance.IsValid())
@@ -327,28 +452,48 @@ void AAlsCharacter::Tick(const float DeltaTime)
 		return;
 	}
 
-	if (IsLocallyControlled())
+	float FixedLogicStepDeltaTime;
+	const auto FixedLogicStepsCount{ConsumeFixedLogicSteps(DeltaTime, FixedLogicStepDeltaTime)};
+
+	if (IsLocallyControlled() && FixedLogicStepsCount > 0)
 	{
-		UpdateControlRotationLimits(DeltaTime);
+		UpdateControlRotationLimits(FixedLogicStepDeltaTime * FixedLogicStepsCount);
 	}
 
 	RefreshMovementBase();
 
 	RefreshMeshProperties();
 
+	RefreshVelocityNetworkSmoothing(DeltaTime);
+
 	RefreshInput(DeltaTime);
 
 	RefreshLocomotionEarly();
 
-	RefreshView(DeltaTime);
+	// The gait and the rotations read the view rotation in every frame, and the movement base rotation offsets are
+	// per frame, so the view is refreshed in every frame, and only its network smoothing runs at the fixed rate.
+
+	RefreshView(DeltaTime, FixedLogicStepDeltaTime * FixedLogicStepsCount);
+
 	RefreshLocomotion();
 	RefreshGait();
 	RefreshRotationMode();
 
 	RefreshGroundedRotation(DeltaTime);
-	RefreshInAirRotation(DeltaTime);
 
-	StartMantlingInAir();
+	// The in air rotation is interpolated towards a target, so it is sub-stepped with the fixed step delta time to get
+	// the same result regardless of the server frame rate.
+
+	for (auto i{0}; i < FixedLogicStepsCount; i++)
+	{
+		RefreshInAirRotation(FixedLogicStepDeltaTime);
+	}
+
+	if (FixedLogicStepsCount > 0)
+	{
+		StartMantlingInAir();
+	}
+
 	RefreshMantling();
 	RefreshRagdolling(DeltaTime);
 	RefreshRolling(DeltaTime);
@@ -356,6 +501,31 @@ void AAlsCharacter::Tick(const float DeltaTime)
 	Super::Tick(DeltaTime);
 
 	RefreshLocomotionLate();
+
+	RecordPoseHistory();
+
+	TRACE_ALS_CHARACTER_STATE(*this, AlsCharacterMovement->GetFloorQueriesCount())
+}
+
+int32 AAlsCharacter::ConsumeFixedLogicSteps(const float DeltaTime, float& StepDeltaTime)
+{
+	if (!IsNetMode(NM_DedicatedServer) || Settings->DedicatedServerFixedLogicRate <= 0.0f)
+	{
+		StepDeltaTime = DeltaTime;
+		return 1;
+	}
+
+	StepDeltaTime = 1.0f / Settings->DedicatedServerFixedLogicRate;
+
+	FixedLogicAccumulatedTime += DeltaTime;
+
+	const auto StepsCount{
+		FMath::Min(FMath::FloorToInt32(FixedLogicAccumulatedTime / StepDeltaTime), Settings->MaxDedicatedServerFixedLogicSteps)
+	};
+
+	FixedLogicAccumulatedTime = FMath::Min(FixedLogicAccumulatedTime - StepsCount * StepDeltaTime, StepDeltaTime);
+
+	return StepsCount;
 }
 
 void AAlsCharacter::PossessedBy(AController* NewController)
@@ -405,6 +575,8 @@ bool AAlsCharacter::OnCalculateCamera_Implementation(float DeltaTime, FMinimalVi
 
 void AAlsCharacter::RefreshMeshProperties() const
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshMeshProperties)
+
 	const auto bStandalone{IsNetMode(NM_Standalone)};
 	const auto bDedicatedServer{IsNetMode(NM_DedicatedServer)};
 	const auto bListenServer{IsNetMode(NM_ListenServer)};
@@ -482,6 +654,8 @@ void AAlsCharacter::RefreshMeshProperties() const
 
 void AAlsCharacter::RefreshMovementBase()
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshMovementBase)
+
 	if (BasedMovement.MovementBase != MovementBase.Primitive || BasedMovement.BoneName != MovementBase.BoneName)
 	{
 		MovementBase.Primitive = BasedMovement.MovementBase;
@@ -537,11 +711,15 @@ void AAlsCharacter::SetViewMode(const FGameplayTag& NewViewMode, const bool bSen
 
 void AAlsCharacter::ClientSetViewMode_Implementation(const FGameplayTag& NewViewMode)
 {
+	ALS_COUNT_CLIENT_RPC(ClientSetViewMode);
+
 	SetViewMode(NewViewMode, false);
 }
 
 void AAlsCharacter::ServerSetViewMode_Implementation(const FGameplayTag& NewViewMode)
 {
+	ALS_COUNT_SERVER_RPC(ServerSetViewMode);
+
 	SetViewMode(NewViewMode, false);
 }
 
@@ -694,11 +872,15 @@ void AAlsCharacter::SetDesiredAiming(const bool bNewDesiredAiming, const bool bS
 
 void AAlsCharacter::ClientSetDesiredAiming_Implementation(const bool bNewDesiredAiming)
 {
+	ALS_COUNT_CLIENT_RPC(ClientSetDesiredAiming);
+
 	SetDesiredAiming(bNewDesiredAiming, false);
 }
 
 void AAlsCharacter::ServerSetDesiredAiming_Implementation(const bool bNewDesiredAiming)
 {
+	ALS_COUNT_SERVER_RPC(ServerSetDesiredAiming);
+
 	SetDesiredAiming(bNewDesiredAiming, false);
 }
 
@@ -740,11 +922,15 @@ void AAlsCharacter::SetDesiredRotationMode(const FGameplayTag& NewDesiredRotatio
 
 void AAlsCharacter::ClientSetDesiredRotationMode_Implementation(const FGameplayTag& NewDesiredRotationMode)
 {
+	ALS_COUNT_CLIENT_RPC(ClientSetDesiredRotationMode);
+
 	SetDesiredRotationMode(NewDesiredRotationMode, false);
 }
 
 void AAlsCharacter::ServerSetDesiredRotationMode_Implementation(const FGameplayTag& NewDesiredRotationMode)
 {
+	ALS_COUNT_SERVER_RPC(ServerSetDesiredRotationMode);
+
 	SetDesiredRotationMode(NewDesiredRotationMode, false);
 }
 
@@ -774,6 +960,8 @@ void AAlsCharacter::NotifyRotationModeChanged(const FGameplayTag& PreviousRotati
 
 void AAlsCharacter::RefreshRotationMode()
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshRotationMode)
+
 	const auto bAiming{bDesiredAiming || DesiredRotationMode == AlsRotationModeTags::Aiming};
 	const auto bSprinting{AlsCharacterMovement->GetMaxAllowedGait() == AlsGaitTags::Sprinting};
 
@@ -890,11 +1078,15 @@ void AAlsCharacter::SetDesiredStance(const FGameplayTag& NewDesiredStance, const
 
 void AAlsCharacter::ClientSetDesiredStance_Implementation(const FGameplayTag& NewDesiredStance)
 {
+	ALS_COUNT_CLIENT_RPC(ClientSetDesiredStance);
+
 	SetDesiredStance(NewDesiredStance, false);
 }
 
 void AAlsCharacter::ServerSetDesiredStance_Implementation(const FGameplayTag& NewDesiredStance)
 {
+	ALS_COUNT_SERVER_RPC(ServerSetDesiredStance);
+
 	SetDesiredStance(NewDesiredStance, false);
 }
 
@@ -1024,6 +1216,8 @@ void AAlsCharacter::SetStance(const FGameplayTag& NewStance)
 
 void AAlsCharacter::MulticastSetStance_Implementation(const FGameplayTag& NewStance)
 {
+	ALS_COUNT_MULTICAST_RPC(this, MulticastSetStance);
+
 	SetStance(NewStance);
 }
 
@@ -1060,11 +1254,15 @@ void AAlsCharacter::SetDesiredGait(const FGameplayTag& NewDesiredGait, const boo
 
 void AAlsCharacter::ClientSetDesiredGait_Implementation(const FGameplayTag& NewDesiredGait)
 {
+	ALS_COUNT_CLIENT_RPC(ClientSetDesiredGait);
+
 	SetDesiredGait(NewDesiredGait, false);
 }
 
 void AAlsCharacter::ServerSetDesiredGait_Implementation(const FGameplayTag& NewDesiredGait)
 {
+	ALS_COUNT_SERVER_RPC(ServerSetDesiredGait);
+
 	SetDesiredGait(NewDesiredGait, false);
 }
 
@@ -1084,6 +1282,8 @@ void AAlsCharacter::OnGaitChanged_Implementation(const FGameplayTag& PreviousGai
 
 void AAlsCharacter::RefreshGait()
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshGait)
+
 	if (LocomotionMode != AlsLocomotionModeTags::Grounded)
 	{
 		return;
@@ -1187,6 +1387,8 @@ void AAlsCharacter::SetOverlayMode(const FGameplayTag& NewOverlayMode, const boo
 
 	MARK_PROPERTY_DIRTY_FROM_NAME(AAlsCharacter, OverlayMode, this)
 
+	RefreshOverlayLayer();
+
 	OnOverlayModeChanged(PreviousOverlayMode);
 
 	if (bSendRpc)
@@ -1204,19 +1406,115 @@ void AAlsCharacter::SetOverlayMode(const FGameplayTag& NewOverlayMode, const boo
 
 void AAlsCharacter::ClientSetOverlayMode_Implementation(const FGameplayTag& NewOverlayMode)
 {
+	ALS_COUNT_CLIENT_RPC(ClientSetOverlayMode);
+
 	SetOverlayMode(NewOverlayMode, false);
 }
 
 void AAlsCharacter::ServerSetOverlayMode_Implementation(const FGameplayTag& NewOverlayMode)
 {
+	ALS_COUNT_SERVER_RPC(ServerSetOverlayMode);
+
 	SetOverlayMode(NewOverlayMode, false);
 }
 
 void AAlsCharacter::OnReplicated_OverlayMode(const FGameplayTag& PreviousOverlayMode)
 {
+	RefreshOverlayLayer();
+
 	OnOverlayModeChanged(PreviousOverlayMode);
 }
 
+void AAlsCharacter::PreloadOverlayLayer(const FGameplayTag& OverlayModeToPreload)
+{
+	if (!IsValid(Settings) || OverlayLayerPreloadHandles.Contains(OverlayModeToPreload))
+	{
+		return;
+	}
+
+	const auto* LayerClass{Settings->Overlay.LayerClasses.Find(OverlayModeToPreload)};
+	if (LayerClass == nullptr || LayerClass->IsNull())
+	{
+		return;
+	}
+
+	// The handle keeps the layer class and the animations it references loaded, even if the class is already loaded.
+
+	OverlayLayerPreloadHandles.Emplace(OverlayModeToPreload,
+	                                   UAssetManager::GetStreamableManager().RequestAsyncLoad(LayerClass->ToSoftObjectPath()));
+}
+
+void AAlsCharacter::RefreshOverlayLayer()
+{
+	if (OverlayLayerLoadHandle.IsValid())
+	{
+		// The layer class of the previous overlay mode is still loading, but it is no longer needed.
+
+		OverlayLayerLoadHandle->CancelHandle();
+		OverlayLayerLoadHandle.Reset();
+	}
+
+	const auto* LayerClass{IsValid(Settings) ? Settings->Overlay.LayerClasses.Find(OverlayMode) : nullptr};
+	if (LayerClass == nullptr || LayerClass->IsNull())
+	{
+		LinkOverlayLayer(nullptr);
+		return;
+	}
+
+	if (LayerClass->IsValid())
+	{
+		LinkOverlayLayer(LayerClass->Get());
+		return;
+	}
+
+	// Instead of loading the layer class synchronously, load it in the background and link it when loading
+	// is complete. Until then, the layers of the previous overlay mode remain linked.
+
+	OverlayLayerLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		LayerClass->ToSoftObjectPath(), FStreamableDelegate::CreateWeakLambda(this, [this, LayerClass = *LayerClass]
+		{
+			OverlayLayerLoadHandle.Reset();
+
+			if (IsValid(LayerClass.Get()))
+			{
+				LinkOverlayLayer(LayerClass.Get());
+			}
+		}), FStreamableManager::AsyncLoadHighPriority);
+}
+
+void AAlsCharacter::LinkOverlayLayer(const TSubclassOf<UAnimInstance> NewLayerClass)
+{
+	if (LinkedOverlayLayerClass == NewLayerClass)
+	{
+		return;
+	}
+
+	if (!IsValid(NewLayerClass))
+	{
+		GetMesh()->UnlinkAnimClassLayers(LinkedOverlayLayerClass);
+		LinkedOverlayLayerClass = nullptr;
+		return;
+	}
+
+	// Linking replaces the layers of the previous overlay mode that implement the same layer interfaces,
+	// so there is no need to unlink them first, which would link the default layers for nothing.
+
+	GetMesh()->LinkAnimClassLayers(NewLayerClass);
+	LinkedOverlayLayerClass = NewLayerClass;
+
+	// Keep the recently linked layer classes referenced, so that switching back to them (which happens
+	// all the time when swapping weapons) doesn't require loading the classes and their animations again.
+
+	CachedOverlayLayerClasses.Remove(NewLayerClass);
+	CachedOverlayLayerClasses.Emplace(NewLayerClass);
+
+	const auto MaxCachedLayerClasses{IsValid(Settings) ? FMath::Max(1, Settings->Overlay.MaxCachedLayerClasses) : 1};
+	if (CachedOverlayLayerClasses.Num() > MaxCachedLayerClasses)
+	{
+		CachedOverlayLayerClasses.RemoveAt(0, CachedOverlayLayerClasses.Num() - MaxCachedLayerClasses);
+	}
+}
+
 void AAlsCharacter::OnOverlayModeChanged_Implementation(const FGameplayTag& PreviousOverlayMode) {}
 
 void AAlsCharacter::SetLocomotionAction(const FGameplayTag& NewLocomotionAction)
@@ -1264,16 +1562,22 @@ void AAlsCharacter::SetInputDirection(FVector NewInputDirection)
 
 void AAlsCharacter::RefreshInput(const float DeltaTime)
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshInput)
+
 	if (GetLocalRole() >= ROLE_AutonomousProxy)
 	{
 		SetInputDirection(GetCharacterMovement()->GetCurrentAcceleration() / GetCharacterMovement()->GetMaxAcceleration());
 	}
 
-	LocomotionState.bHasInput = InputDirection.SizeSquared() > UE_KINDA_SMALL_NUMBER;
+	const auto NewInputDirection{
+		VelocityNetworkSmoothing.bEnabled ? VelocityNetworkSmoothing.CurrentInputDirection : FVector{InputDirection}
+	};
+
+	LocomotionState.bHasInput = NewInputDirection.SizeSquared() > UE_KINDA_SMALL_NUMBER;
 
 	if (LocomotionState.bHasInput)
 	{
-		LocomotionState.InputYawAngle = UE_REAL_TO_FLOAT(UAlsVector::DirectionToAngleXY(InputDirection));
+		LocomotionState.InputYawAngle = UE_REAL_TO_FLOAT(UAlsVector::DirectionToAngleXY(NewInputDirection));
 	}
 }
 
@@ -1294,6 +1598,8 @@ void AAlsCharacter::SetReplicatedViewRotation(const FRotator& NewViewRotation, c
 
 void AAlsCharacter::ServerSetReplicatedViewRotation_Implementation(const FRotator& NewViewRotation)
 {
+	ALS_COUNT_SERVER_RPC(ServerSetReplicatedViewRotation);
+
 	SetReplicatedViewRotation(NewViewRotation, false);
 }
 
@@ -1368,8 +1674,10 @@ const FRotator& AAlsCharacter::GetReplicatedViewRotation() const
 	return ReplicatedViewRotation;
 }
 
-void AAlsCharacter::RefreshView(const float DeltaTime)
+void AAlsCharacter::RefreshView(const float DeltaTime, const float NetworkSmoothingDeltaTime)
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshView)
+
 	if (MovementBase.bHasRelativeRotation)
 	{
 		// Offset the rotations to keep them relative to the movement base.
@@ -1402,7 +1710,7 @@ void AAlsCharacter::RefreshView(const float DeltaTime)
 		}
 	}
 
-	RefreshViewNetworkSmoothing(DeltaTime);
+	RefreshViewNetworkSmoothing(NetworkSmoothingDeltaTime);
 
 	ViewState.Rotation = ViewState.NetworkSmoothing.CurrentRotation;
 
@@ -1457,6 +1765,11 @@ void AAlsCharacter::RefreshViewNetworkSmoothing(const float DeltaTime)
 		NetworkSmoothing.CurrentRotation.Normalize();
 	}
 
+	if (DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
 	NetworkSmoothing.ClientTime += DeltaTime;
 
 	const auto InterpolationAmount{
@@ -1482,6 +1795,8 @@ void AAlsCharacter::SetDesiredVelocityYawAngle(const float NewVelocityYawAngle)
 
 void AAlsCharacter::RefreshLocomotionEarly()
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshLocomotionEarly)
+
 	if (!LocomotionState.bMoving &&
 	    RotationMode == AlsRotationModeTags::VelocityDirection &&
 	    Settings->bInheritMovementBaseRotationInVelocityDirectionRotationMode)
@@ -1519,9 +1834,11 @@ void AAlsCharacter::RefreshLocomotionEarly()
 
 void AAlsCharacter::RefreshLocomotion()
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshLocomotion)
+
 	const auto bHadVelocity{LocomotionState.bHasVelocity};
 
-	LocomotionState.Velocity = GetVelocity();
+	LocomotionState.Velocity = VelocityNetworkSmoothing.bEnabled ? VelocityNetworkSmoothing.CurrentVelocity : GetVelocity();
 
 	// Determine if the character is moving by getting its speed. The speed equals the length
 	// of the horizontal velocity, so it does not take vertical movement into account. If the
@@ -1584,8 +1901,45 @@ void AAlsCharacter::RefreshLocomotion()
 	                          LocomotionState.Speed > Settings->MovingSpeedThreshold;
 }
 
+void AAlsCharacter::CorrectVelocityNetworkSmoothing(const FVector& NewVelocity)
+{
+	if (!VelocityNetworkSmoothing.bEnabled)
+	{
+		return;
+	}
+
+	// The input direction is replicated in the same bunch as the velocity, so it is already up to date here.
+
+	VelocityNetworkSmoothing.Correct(GetReplicatedServerLastTransformUpdateTimeStamp(), NewVelocity, InputDirection,
+	                                 GetDefault<AGameNetworkManager>()->MaxClientSmoothingDeltaTime,
+	                                 Settings->MaxVelocityExtrapolationTime, GetCharacterMovement()->GetMaxSpeed());
+}
+
+void AAlsCharacter::RefreshVelocityNetworkSmoothing(const float DeltaTime)
+{
+	auto& NetworkSmoothing{VelocityNetworkSmoothing};
+
+	if (!NetworkSmoothing.bEnabled)
+	{
+		return;
+	}
+
+	if (!NetworkSmoothing.ServerInputDirection.Equals(InputDirection))
+	{
+		// The input direction can be replicated without the velocity, for example, when the character is blocked
+		// by a wall, in which case there is no server time to blend over, so the input direction is snapped.
+
+		NetworkSmoothing.ServerInputDirection = InputDirection;
+		NetworkSmoothing.InitialInputDirection = InputDirection;
+	}
+
+	NetworkSmoothing.Refresh(DeltaTime, Settings->MaxVelocityExtrapolationTime, GetCharacterMovement()->GetMaxSpeed());
+}
+
 void AAlsCharacter::RefreshLocomotionLate()
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshLocomotionLate)
+
 	if (!LocomotionMode.IsValid() || (LocomotionAction.IsValid() && GetViewMode() == AlsViewModeTags::ThirdPerson))
 	{
 		RefreshTargetYawAngleUsingActorRotation();
@@ -1596,11 +1950,15 @@ void AAlsCharacter::RefreshLocomotionLate()
 
 void AAlsCharacter::ServerSetInitialVelocityYawAngle_Implementation(const float NewVelocityYawAngle)
 {
+	ALS_COUNT_SERVER_RPC(ServerSetInitialVelocityYawAngle);
+
 	MulticastSetInitialVelocityYawAngle(NewVelocityYawAngle);
 }
 
 void AAlsCharacter::MulticastSetInitialVelocityYawAngle_Implementation(const float NewVelocityYawAngle)
 {
+	ALS_COUNT_MULTICAST_RPC(this, MulticastSetInitialVelocityYawAngle);
+
 	if (GetLocalRole() != ROLE_AutonomousProxy)
 	{
 		DesiredVelocityYawAngle = NewVelocityYawAngle;
@@ -1634,6 +1992,8 @@ void AAlsCharacter::OnJumped_Implementation()
 
 void AAlsCharacter::MulticastOnJumpedNetworked_Implementation()
 {
+	ALS_COUNT_MULTICAST_RPC(this, MulticastOnJumpedNetworked);
+
 	if (GetLocalRole() != ROLE_AutonomousProxy)
 	{
 		OnJumpedNetworked();
@@ -1661,6 +2021,8 @@ void AAlsCharacter::CharacterMovement_OnPhysicsRotation(const float DeltaTime)
 
 void AAlsCharacter::RefreshGroundedRotation(const float DeltaTime)
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshGroundedRotation)
+
 	if ((LocomotionAction.IsValid() && GetViewMode() == AlsViewModeTags::ThirdPerson) || LocomotionMode != AlsLocomotionModeTags::Grounded)
 	{
 		return;
@@ -1958,6 +2320,8 @@ void AAlsCharacter::ApplyRotationYawSpeedAnimationCurve(const float DeltaTime)
 
 void AAlsCharacter::RefreshInAirRotation(const float DeltaTime)
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshInAirRotation)
+
 	if ((LocomotionAction.IsValid() && GetViewMode() == AlsViewModeTags::ThirdPerson) || LocomotionMode != AlsLocomotionModeTags::InAir)
 	{
 		return;
@@ -2246,6 +2610,8 @@ void AAlsCharacter::RecalculatePronedEyeHeight()
 
 void AAlsCharacter::UpdateControlRotationLimits(float DeltaTime)
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, UpdateControlRotationLimits)
+
 	if (!IsValid(Controller) || !IsValid(ControlRotationLimitSettings))
 	{
 		bControlRotationLimitsActive = false;
@@ -6,26 +6,44 @@
 #include "Curves/CurveVector.h"
 #include "Engine/World.h"
 #include "GameFramework/Controller.h"
+#include "HAL/IConsoleManager.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsRotation.h"
+#include "Utility/AlsScopedMeshMovementUpdate.h"
+#include "Utility/AlsStats.h"
 #include "Utility/AlsUtility.h"
 #include "Utility/AlsVector.h"
-#include "Engine/ScopedMovementUpdate.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCharacterMovementComponent)
 
-DECLARE_CYCLE_STAT(TEXT("AlsChar ClientUpdatePositionAfterServerUpdate"), STAT_AlsCharacterMovementClientUpdatePositionAfterServerUpdate, STATGROUP_Als);
+namespace AlsCharacterMovementComponent
+{
+	static auto bDeferMeshMovementDuringReplay{true};
+	static FAutoConsoleVariableRef ConsoleVariableDeferMeshMovementDuringReplay{
+		TEXT("als.Movement.DeferMeshMovementDuringReplay"), bDeferMeshMovementDuringReplay,
+		TEXT("Defers mesh transform updates until all saved moves are replayed after a server correction. ")
+		TEXT("Not used while animation root motion is resimulated, since it is converted using the mesh transform."),
+		ECVF_Default
+	};
+}
 
-struct FAlsScopedMeshMovementUpdate
+bool FAlsScopedMeshMovementUpdate::CanDefer(const USkeletalMeshComponent* Mesh)
 {
-	FAlsScopedMeshMovementUpdate(USkeletalMeshComponent* Mesh, bool bEnabled = true)
-		: ScopedMoveUpdate(bEnabled && /*CharacterMovementCVars::bDeferCharacterMeshMovement*/ false ? Mesh : nullptr, EScopedUpdate::DeferredUpdates)
+	if (!AlsCharacterMovementComponent::bDeferMeshMovementDuringReplay || !IsValid(Mesh))
 	{
+		return false;
 	}
 
-private:
-	FScopedMovementUpdate ScopedMoveUpdate;
-};
+	const auto* Character{Cast<ACharacter>(Mesh->GetOwner())};
+
+	// The mesh is detached while ragdolling, so there is nothing to defer. Animation root motion is converted
+	// to world space using the mesh transform, so it must stay up to date while the root motion is replayed.
+	// Absolute mesh rotation needs no special handling here, since the mesh rotation does not depend on the
+	// capsule and is only synchronized from the animation instance after the movement is complete.
+
+	return IsValid(Character) && Mesh->GetAttachParent() == Character->GetRootComponent() &&
+	       !Character->bClientResimulateRootMotion && !Character->IsPlayingNetworkedRootMotionMontage();
+}
 
 void FAlsCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& Move, const ENetworkMoveType MoveType)
 {
@@ -68,6 +86,13 @@ void FAlsSavedMove::Clear()
 	bWantsToProne = false;
 
 	Saved_bPrevWantsToCrouch = false;
+
+	Saved_BlockedStanceExitLocation = FVector::ZeroVector;
+	Saved_BlockedStanceExitRotation = FQuat::Identity;
+	Saved_BlockedStanceExitBase.Reset();
+	Saved_BlockedStanceExitCapsuleHalfHeight = 0.0f;
+	Saved_BlockedStanceExitRetryTimeRemaining = 0.0f;
+	Saved_BlockedStanceExitAttemptsCount = 0;
 }
 
 void FAlsSavedMove::SetMoveFor(ACharacter* Character, const float NewDeltaTime, const FVector& NewAcceleration,
@@ -85,6 +110,13 @@ void FAlsSavedMove::SetMoveFor(ACharacter* Character, const float NewDeltaTime,
 		bWantsToProne = Movement->bWantsToProne;
 
 		Saved_bPrevWantsToCrouch = Movement->Safe_bPrevWantsToCrouch;
+
+		Saved_BlockedStanceExitLocation = Movement->BlockedStanceExitLocation;
+		Saved_BlockedStanceExitRotation = Movement->BlockedStanceExitRotation;
+		Saved_BlockedStanceExitBase = Movement->BlockedStanceExitBase;
+		Saved_BlockedStanceExitCapsuleHalfHeight = Movement->BlockedStanceExitCapsuleHalfHeight;
+		Saved_BlockedStanceExitRetryTimeRemaining = Movement->BlockedStanceExitRetryTimeRemaining;
+		Saved_BlockedStanceExitAttemptsCount = Movement->BlockedStanceExitAttemptsCount;
 	}
 }
 
@@ -92,9 +124,13 @@ bool FAlsSavedMove::CanCombineWith(const FSavedMovePtr& NewMovePtr, ACharacter*
 {
 	const auto* NewMove{static_cast<FAlsSavedMove*>(NewMovePtr.Get())}; // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
 
+	// Don't combine moves across a blocked stance exit attempt, otherwise the combined
+	// move would start with a different throttle state than the one it was predicted with.
+
 	return RotationMode == NewMove->RotationMode &&
 	       Stance == NewMove->Stance &&
 	       MaxAllowedGait == NewMove->MaxAllowedGait &&
+	       Saved_BlockedStanceExitAttemptsCount == NewMove->Saved_BlockedStanceExitAttemptsCount &&
 	       Super::CanCombineWith(NewMovePtr, Character, MaxDeltaTime);
 }
 
@@ -135,6 +171,13 @@ void FAlsSavedMove::PrepMoveFor(ACharacter* Character)
 		Movement->RefreshGaitSettings();
 
 		Movement->Safe_bPrevWantsToCrouch = Saved_bPrevWantsToCrouch;
+
+		Movement->BlockedStanceExitLocation = Saved_BlockedStanceExitLocation;
+		Movement->BlockedStanceExitRotation = Saved_BlockedStanceExitRotation;
+		Movement->BlockedStanceExitBase = Saved_BlockedStanceExitBase;
+		Movement->BlockedStanceExitCapsuleHalfHeight = Saved_BlockedStanceExitCapsuleHalfHeight;
+		Movement->BlockedStanceExitRetryTimeRemaining = Saved_BlockedStanceExitRetryTimeRemaining;
+		Movement->BlockedStanceExitAttemptsCount = Saved_BlockedStanceExitAttemptsCount;
 	}
 }
 
@@ -193,6 +236,10 @@ UAlsCharacterMovementComponent::UAlsCharacterMovementComponent()
 	bCanWalkOffLedgesWhenCrouching = true;
 	bCanWalkOffLedgesWhenProning = true;
 
+	bThrottleBlockedStanceExit = true;
+	BlockedStanceExitRetryInterval = 0.1f;
+	BlockedStanceExitMaxRetryInterval = 0.8f;
+
 	// Subtracted from the capsule radius to check how far the actor is allowed to
 	// perch on the edge of a surface. Currently this is half the capsule radius.
 	PerchRadiusThreshold = 15.0f;
@@ -354,6 +401,8 @@ bool UAlsCharacterMovementComponent::ApplyRequestedMove(const float DeltaTime, c
 void UAlsCharacterMovementComponent::CalcVelocity(const float DeltaTime, const float Friction,
                                                   const bool bFluid, const float BrakingDeceleration)
 {
+	ALS_SCOPED_HOT_STAGE_STAT(AlsMovement, CalcVelocity)
+
 	FRotator BaseRotationSpeed;
 	if (!bIgnoreBaseRotation && UAlsUtility::TryGetMovementBaseRotationSpeed(CharacterOwner->GetBasedMovement(), BaseRotationSpeed))
 	{
@@ -416,9 +465,11 @@ bool UAlsCharacterMovementComponent::CanAttemptJump() const
 
 void UAlsCharacterMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
 {
+	ALS_SCOPED_STAGE_STAT(AlsMovement, UpdateCharacterStateBeforeMovement)
+
 	if (MovementMode == MOVE_Walking && IsSlideTriggered())
 	{
-		if (CanSlide(false) && GaitAmount >= MinSlideGaitAmount)
+		if (GaitAmount >= MinSlideGaitAmount && CanSlide(false))
 		{
 			SetMovementMode(MOVE_Custom, CMOVE_Slide);
 		}
@@ -430,6 +481,11 @@ void UAlsCharacterMovementComponent::UpdateCharacterStateBeforeMovement(float De
 
 	if (CharacterOwner->GetLocalRole() != ROLE_SimulatedProxy)
 	{
+		// The delta time is the delta time of the move being performed, not the frame delta time, so the throttle
+		// advances the same way when the move is performed by the client, the server, or replayed after a correction.
+
+		BlockedStanceExitRetryTimeRemaining = FMath::Max(0.0f, BlockedStanceExitRetryTimeRemaining - DeltaSeconds);
+
 		// Cache input intents for this tick.
 		const bool bRequestCrouch = bWantsToCrouch;
 		const bool bRequestProne = bWantsToProne;
@@ -437,21 +493,21 @@ void UAlsCharacterMovementComponent::UpdateCharacterStateBeforeMovement(float De
 		// 1) Exit invalid or undesired states first.
 		if (IsCrouching() && (!bRequestCrouch || !CanCrouchInCurrentState()))
 		{
-			UnCrouch(false);
+			TryUnCrouch();
 		}
 		if (IsProning() && (!bRequestProne || !CanProneInCurrentState()))
 		{
-			UnProne(false);
+			TryUnProne();
 		}
 
 		// 2) Enforce mutual exclusivity: leave the opposite state before entering the new one.
 		if (bRequestProne && IsCrouching())
 		{
-			UnCrouch(false);
+			TryUnCrouch();
 		}
 		if (bRequestCrouch && IsProning())
 		{
-			UnProne(false);
+			TryUnProne();
 		}
 
 		// 3) Enter desired state. Prone has precedence if both are requested.
@@ -468,6 +524,8 @@ void UAlsCharacterMovementComponent::UpdateCharacterStateBeforeMovement(float De
 
 void UAlsCharacterMovementComponent::UpdateCharacterStateAfterMovement(float DeltaSeconds)
 {
+	ALS_SCOPED_STAGE_STAT(AlsMovement, UpdateCharacterStateAfterMovement)
+
 	if (CharacterOwner->GetLocalRole() != ROLE_SimulatedProxy)
 	{
 		// Uncrouch if no longer allowed to be crouched
@@ -527,6 +585,8 @@ void UAlsCharacterMovementComponent::ControlledCharacterMove(const FVector& Inpu
 
 void UAlsCharacterMovementComponent::PhysicsRotation(const float DeltaTime)
 {
+	ALS_SCOPED_HOT_STAGE_STAT(AlsMovement, PhysicsRotation)
+
 	Super::PhysicsRotation(DeltaTime);
 
 	if (HasValidData() && (bRunPhysicsWithNoController || IsValid(CharacterOwner->GetController())))
@@ -547,6 +607,8 @@ void UAlsCharacterMovementComponent::MoveSmooth(const FVector& InVelocity, const
 
 void UAlsCharacterMovementComponent::PhysWalking(const float DeltaTime, int32 IterationsCount)
 {
+	ALS_SCOPED_STAGE_STAT(AlsMovement, PhysWalking)
+
 	RefreshGroundedMovementSettings();
 
 	auto Iterations{IterationsCount};
@@ -818,6 +880,8 @@ void UAlsCharacterMovementComponent::PhysNavWalking(const float DeltaTime, const
 
 void UAlsCharacterMovementComponent::PhysCustom(const float DeltaTime, int32 IterationsCount)
 {
+	ALS_SCOPED_STAGE_STAT(AlsMovement, PhysCustom)
+
 	if (DeltaTime < MIN_TICK_TIME)
 	{
 		Super::PhysCustom(DeltaTime, IterationsCount);
@@ -851,6 +915,7 @@ void UAlsCharacterMovementComponent::PhysCustom(const float DeltaTime, int32 Ite
 bool UAlsCharacterMovementComponent::ClientUpdatePositionAfterServerUpdate()
 {
 	SCOPE_CYCLE_COUNTER(STAT_AlsCharacterMovementClientUpdatePositionAfterServerUpdate);
+	CSV_SCOPED_TIMING_STAT(AlsMovement, ClientUpdatePositionAfterServerUpdate);
 	if (!HasValidData())
 	{
 		return false;
@@ -864,6 +929,8 @@ bool UAlsCharacterMovementComponent::ClientUpdatePositionAfterServerUpdate()
 		return false;
 	}
 
+	ALS_COUNT_NETWORK_EVENT(STAT_Als_ClientMovementCorrections, ClientMovementCorrections);
+
 	ClientData->bUpdatePosition = false;
 
 	// Don't do any network position updates on things running PHYS_RigidBody
@@ -904,7 +971,7 @@ bool UAlsCharacterMovementComponent::ClientUpdatePositionAfterServerUpdate()
 	bForceNextFloorCheck = true;
 
 	// Defer all mesh child updates until all movement completes.
-	FAlsScopedMeshMovementUpdate ScopedMeshUpdate(CharacterOwner->GetMesh(), /*CharacterMovementCVars::bDeferCharacterMeshMovementForAllCorrections*/ true);
+	FAlsScopedMeshMovementUpdate ScopedMeshUpdate(CharacterOwner->GetMesh());
 
 	// Replay moves that have not yet been acked.
 	UE_LOG(LogNetPlayerMovement, Verbose, TEXT("ClientUpdatePositionAfterServerUpdate Replaying %d Moves, starting at Timestamp %f"), ClientData->SavedMoves.Num(), ClientData->SavedMoves[0]->TimeStamp);
@@ -971,9 +1038,13 @@ void UAlsCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLoca
                                                       float SweepDistance, FFindFloorResult& OutFloorResult,
                                                       float SweepRadius, const FHitResult* DownwardSweepResult) const
 {
+	ALS_SCOPED_HOT_STAGE_STAT(AlsMovement, ComputeFloorDist)
+
 	// TODO Copied with modifications from UCharacterMovementComponent::ComputeFloorDist().
 	// TODO After the release of a new engine version, this code should be updated to match the source code.
 
+	FloorQueriesCount += 1;
+
 	// ReSharper disable All
 
 	// UE_LOG(LogCharacterMovement, VeryVerbose, TEXT("[Role:%d] ComputeFloorDist: %s at location %s"), (int32)CharacterOwner->GetLocalRole(), *GetNameSafe(CharacterOwner), *CapsuleLocation.ToString());
@@ -1143,6 +1214,8 @@ void UAlsCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLoca
 
 void UAlsCharacterMovementComponent::PerformMovement(const float DeltaTime)
 {
+	ALS_SCOPED_STAGE_STAT(AlsMovement, PerformMovement)
+
 	Super::PerformMovement(DeltaTime);
 
 	// Update the ServerLastTransformUpdateTimeStamp when the control rotation
@@ -1178,6 +1251,8 @@ FNetworkPredictionData_Client* UAlsCharacterMovementComponent::GetPredictionData
 
 void UAlsCharacterMovementComponent::SmoothClientPosition(const float DeltaTime)
 {
+	ALS_SCOPED_STAGE_STAT(AlsMovement, SmoothClientPosition)
+
 	auto* PredictionData{GetPredictionData_Client_Character()};
 	const auto* Mesh{HasValidData() ? CharacterOwner->GetMesh() : nullptr};
 
@@ -1200,6 +1275,8 @@ void UAlsCharacterMovementComponent::SmoothClientPosition(const float DeltaTime)
 void UAlsCharacterMovementComponent::MoveAutonomous(const float ClientTimeStamp, const float DeltaTime,
                                                     const uint8 CompressedFlags, const FVector& NewAcceleration)
 {
+	ALS_SCOPED_STAGE_STAT(AlsMovement, MoveAutonomous)
+
 	const auto* MoveData{static_cast<FAlsCharacterNetworkMoveData*>(GetCurrentNetworkMoveData())}; // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
 	if (MoveData != nullptr)
 	{
@@ -1210,8 +1287,15 @@ void UAlsCharacterMovementComponent::MoveAutonomous(const float ClientTimeStamp,
 		RefreshGaitSettings();
 	}
 
+	auto* RecordedMove{bRecordingMoves ? StartRecordingMove(ClientTimeStamp, DeltaTime, CompressedFlags, NewAcceleration) : nullptr};
+
 	Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAcceleration);
 
+	if (RecordedMove != nullptr)
+	{
+		FinishRecordingMove(*RecordedMove);
+	}
+
 	// Process view network smoothing on the listen server.
 
 	const auto* Controller{HasValidData() ? CharacterOwner->GetController() : nullptr};
@@ -1230,6 +1314,16 @@ void UAlsCharacterMovementComponent::MoveAutonomous(const float ClientTimeStamp,
 	}
 }
 
+void UAlsCharacterMovementComponent::ServerSendMoveResponse(const FClientAdjustment& PendingAdjustment)
+{
+	if (!PendingAdjustment.bAckGoodMove)
+	{
+		ALS_COUNT_NETWORK_EVENT(STAT_Als_ServerMovementCorrections, ServerMovementCorrections);
+	}
+
+	Super::ServerSendMoveResponse(PendingAdjustment);
+}
+
 void UAlsCharacterMovementComponent::SetMovementSettings(UAlsMovementSettings* NewMovementSettings)
 {
 	ALS_ENSURE(IsValid(NewMovementSettings));
@@ -1279,6 +1373,8 @@ void UAlsCharacterMovementComponent::SetStance(const FGameplayTag& NewStance)
 
 void UAlsCharacterMovementComponent::RefreshGroundedMovementSettings()
 {
+	ALS_SCOPED_STAGE_STAT(AlsMovement, RefreshGroundedMovementSettings)
+
 	auto WalkSpeed{GaitSettings.WalkForwardSpeed};
 	auto RunSpeed{GaitSettings.RunForwardSpeed};
 
@@ -1391,6 +1487,8 @@ bool UAlsCharacterMovementComponent::TryConsumePrePenetrationAdjustmentVelocity(
 
 void UAlsCharacterMovementComponent::Prone(bool bClientSimulation /*= false*/)
 {
+	ALS_SCOPED_STAGE_STAT(AlsMovement, Prone)
+
 	if (!HasValidData())
 	{
 		return;
@@ -1444,6 +1542,7 @@ void UAlsCharacterMovementComponent::Prone(bool bClientSimulation /*= false*/)
 			FCollisionQueryParams CapsuleParams(SCENE_QUERY_STAT(ProneTrace), false, Character);
 			FCollisionResponseParams ResponseParam;
 			InitCollisionParams(CapsuleParams, ResponseParam);
+			ALS_COUNT_SCENE_QUERY(CharacterOwner, STAT_Als_ProneSceneQueries, Prone);
 			const bool bEncroached = GetWorld()->OverlapBlockingTestByChannel(UpdatedComponent->GetComponentLocation() + ScaledHalfHeightAdjust * GetGravityDirection(), GetWorldToGravityTransform(),
 				UpdatedComponent->GetCollisionObjectType(), GetPawnCapsuleCollisionShape(SHRINK_None), CapsuleParams, ResponseParam);
 
@@ -1489,6 +1588,8 @@ void UAlsCharacterMovementComponent::Prone(bool bClientSimulation /*= false*/)
 
 void UAlsCharacterMovementComponent::UnProne(bool bClientSimulation /*= false*/)
 {
+	ALS_SCOPED_STAGE_STAT(AlsMovement, UnProne)
+
 	if (!HasValidData())
 	{
 		return;
@@ -1541,6 +1642,7 @@ void UAlsCharacterMovementComponent::UnProne(bool bClientSimulation /*= false*/)
 		if (!bProneMaintainsBaseLocation)
 		{
 			// Expand in place
+			ALS_COUNT_SCENE_QUERY(CharacterOwner, STAT_Als_ProneSceneQueries, Prone);
 			bEncroached = MyWorld->OverlapBlockingTestByChannel(PawnLocation, GetWorldToGravityTransform(), CollisionChannel, StandingCapsuleShape, CapsuleParams, ResponseParam);
 
 			if (bEncroached)
@@ -1557,6 +1659,7 @@ void UAlsCharacterMovementComponent::UnProne(bool bClientSimulation /*= false*/)
 
 					FHitResult Hit(1.f);
 					const FCollisionShape ShortCapsuleShape = GetPawnCapsuleCollisionShape(SHRINK_HeightCustom, ShrinkHalfHeight);
+					ALS_COUNT_SCENE_QUERY(CharacterOwner, STAT_Als_ProneSceneQueries, Prone);
 					const bool bBlockingHit = MyWorld->SweepSingleByChannel(Hit, PawnLocation, PawnLocation + Down, GetWorldToGravityTransform(), CollisionChannel, ShortCapsuleShape, CapsuleParams);
 					if (Hit.bStartPenetrating)
 					{
@@ -1568,6 +1671,7 @@ void UAlsCharacterMovementComponent::UnProne(bool bClientSimulation /*= false*/)
 						const float DistanceToBase = (Hit.Time * TraceDist) + ShortCapsuleShape.Capsule.HalfHeight;
 						const FVector Adjustment = (-DistanceToBase + StandingCapsuleShape.Capsule.HalfHeight + SweepInflation + MIN_FLOOR_DIST / 2.f) * -GetGravityDirection();
 						const FVector NewLoc = PawnLocation + Adjustment;
+						ALS_COUNT_SCENE_QUERY(CharacterOwner, STAT_Als_ProneSceneQueries, Prone);
 						bEncroached = MyWorld->OverlapBlockingTestByChannel(NewLoc, GetWorldToGravityTransform(), CollisionChannel, StandingCapsuleShape, CapsuleParams, ResponseParam);
 						if (!bEncroached)
 						{
@@ -1582,6 +1686,7 @@ void UAlsCharacterMovementComponent::UnProne(bool bClientSimulation /*= false*/)
 		{
 			// Expand while keeping base location the same.
 			FVector StandingLocation = PawnLocation + (StandingCapsuleShape.GetCapsuleHalfHeight() - CurrentPronedHalfHeight) * -GetGravityDirection();
+			ALS_COUNT_SCENE_QUERY(CharacterOwner, STAT_Als_ProneSceneQueries, Prone);
 			bEncroached = MyWorld->OverlapBlockingTestByChannel(StandingLocation, GetWorldToGravityTransform(), CollisionChannel, StandingCapsuleShape, CapsuleParams, ResponseParam);
 
 			if (bEncroached)
@@ -1593,6 +1698,7 @@ void UAlsCharacterMovementComponent::UnProne(bool bClientSimulation /*= false*/)
 					if (CurrentFloor.bBlockingHit && CurrentFloor.FloorDist > MinFloorDist)
 					{
 						StandingLocation -= (CurrentFloor.FloorDist - MinFloorDist) * -GetGravityDirection();
+						ALS_COUNT_SCENE_QUERY(CharacterOwner, STAT_Als_ProneSceneQueries, Prone);
 						bEncroached = MyWorld->OverlapBlockingTestByChannel(StandingLocation, GetWorldToGravityTransform(), CollisionChannel, StandingCapsuleShape, CapsuleParams, ResponseParam);
 					}
 				}
@@ -1638,6 +1744,82 @@ void UAlsCharacterMovementComponent::UnProne(bool bClientSimulation /*= false*/)
 	}
 }
 
+void UAlsCharacterMovementComponent::TryUnCrouch()
+{
+	if (IsStanceExitBlocked())
+	{
+		INC_DWORD_STAT(STAT_Als_StanceExitAttemptsSkipped);
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_Als_StanceExitAttempts);
+
+	UnCrouch(false);
+	RefreshBlockedStanceExit(IsCrouching());
+}
+
+void UAlsCharacterMovementComponent::TryUnProne()
+{
+	if (IsStanceExitBlocked())
+	{
+		INC_DWORD_STAT(STAT_Als_StanceExitAttemptsSkipped);
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_Als_StanceExitAttempts);
+
+	UnProne(false);
+	RefreshBlockedStanceExit(IsProning());
+}
+
+bool UAlsCharacterMovementComponent::IsStanceExitBlocked() const
+{
+	// The encroachment checks depend only on the capsule transform and size and on the surrounding geometry, so
+	// while the capsule stays in place, the result of the last blocked attempt can be reused. The retry interval
+	// only limits how long a blocked result is trusted in case the geometry itself moves away.
+
+	return bThrottleBlockedStanceExit && BlockedStanceExitAttemptsCount > 0 && BlockedStanceExitRetryTimeRemaining > 0.0f &&
+	       BlockedStanceExitBase == GetMovementBase() &&
+	       BlockedStanceExitCapsuleHalfHeight == CharacterOwner->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight() &&
+	       BlockedStanceExitLocation.Equals(UpdatedComponent->GetComponentLocation(), UE_KINDA_SMALL_NUMBER) &&
+	       BlockedStanceExitRotation.Equals(UpdatedComponent->GetComponentQuat(), UE_KINDA_SMALL_NUMBER);
+}
+
+void UAlsCharacterMovementComponent::RefreshBlockedStanceExit(const bool bBlocked)
+{
+	if (!bBlocked || !bThrottleBlockedStanceExit)
+	{
+		BlockedStanceExitAttemptsCount = 0;
+		BlockedStanceExitRetryTimeRemaining = 0.0f;
+		return;
+	}
+
+	const auto& Location{UpdatedComponent->GetComponentLocation()};
+	const auto& Rotation{UpdatedComponent->GetComponentQuat()};
+	const auto* MovementBase{GetMovementBase()};
+	const auto CapsuleHalfHeight{CharacterOwner->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight()};
+
+	// Start backing off from the beginning if the capsule has moved since the previous blocked attempt.
+
+	if (BlockedStanceExitBase != MovementBase || BlockedStanceExitCapsuleHalfHeight != CapsuleHalfHeight ||
+	    !BlockedStanceExitLocation.Equals(Location, UE_KINDA_SMALL_NUMBER) ||
+	    !BlockedStanceExitRotation.Equals(Rotation, UE_KINDA_SMALL_NUMBER))
+	{
+		BlockedStanceExitAttemptsCount = 0;
+	}
+
+	BlockedStanceExitLocation = Location;
+	BlockedStanceExitRotation = Rotation;
+	BlockedStanceExitBase = MovementBase;
+	BlockedStanceExitCapsuleHalfHeight = CapsuleHalfHeight;
+
+	const auto BackOffScale{static_cast<float>(1 << FMath::Min(BlockedStanceExitAttemptsCount, 16))};
+
+	BlockedStanceExitRetryTimeRemaining = FMath::Min(BlockedStanceExitRetryInterval * BackOffScale, BlockedStanceExitMaxRetryInterval);
+
+	BlockedStanceExitAttemptsCount += 1;
+}
+
 bool UAlsCharacterMovementComponent::CanProneInCurrentState() const
 {
 #if 0
@@ -1702,6 +1884,41 @@ void UAlsCharacterMovementComponent::EnterSlide(EMovementMode PrevMode, ECustomM
 	FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, true, NULL);
 }
 
+void UAlsCharacterMovementComponent::ResetForReuse()
+{
+	if (IsCustomMovementMode(CMOVE_Slide))
+	{
+		ExitSlide();
+	}
+
+	bWantsToCrouch = false;
+	bWantsToProne = false;
+	Safe_bPrevWantsToCrouch = false;
+
+	if (HasValidData())
+	{
+		UnCrouch(false);
+		UnProne(false);
+	}
+
+	bSlideSurfaceTraceValid = false;
+	bSlideSurfaceTraceHit = false;
+	SlideSurfaceTraceBase.Reset();
+
+	BlockedStanceExitBase.Reset();
+	BlockedStanceExitCapsuleHalfHeight = 0.0f;
+	BlockedStanceExitRetryTimeRemaining = 0.0f;
+	BlockedStanceExitAttemptsCount = 0;
+
+	// Stopping mantling only marks its root motion source for removal on the next
+	// move, so clear it here to make sure it isn't applied to the reused character.
+
+	CurrentRootMotion.Clear();
+
+	StopMovementImmediately();
+	SetDefaultMovementMode();
+}
+
 void UAlsCharacterMovementComponent::ExitSlide()
 {
 	bWantsToCrouch = false;
@@ -1710,19 +1927,64 @@ void UAlsCharacterMovementComponent::ExitSlide()
 
 bool UAlsCharacterMovementComponent::CanSlide(bool bCheckSpeed /*= true*/) const
 {
-	const FVector& Start = UpdatedComponent->GetComponentLocation();
-	const FVector End = Start + CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() * 2.5f * FVector::DownVector;
+	// Check the speed first, since it is much cheaper than looking for a surface.
+
+	if (bCheckSpeed && Velocity.SizeSquared() <= FMath::Square(MinSlideSpeed))
+	{
+		return false;
+	}
+
+	return HasSlideSurface();
+}
+
+bool UAlsCharacterMovementComponent::HasSlideSurface() const
+{
+	static constexpr auto SurfaceTraceLengthMultiplier{2.5f};
 
-	FCollisionQueryParams QueryParameters(__FUNCTION__, false, CharacterOwner);
+	const auto CapsuleHalfHeight{CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight()};
 
-	bool bValidSurface = GetWorld()->LineTraceTestByProfile(Start, End, TEXT("BlockAll"), QueryParameters);
-	bool bEnoughSpeed = !bCheckSpeed || Velocity.SizeSquared() > pow(MinSlideSpeed, 2);
+	// Reuse the floor already found by the movement component if it is close enough to
+	// the bottom of the capsule. This covers almost all checks while walking or sliding.
 
-	return bValidSurface && bEnoughSpeed;
+	if (CurrentFloor.bBlockingHit && CurrentFloor.GetDistanceToFloor() <= CapsuleHalfHeight * (SurfaceTraceLengthMultiplier - 1.0f))
+	{
+		return true;
+	}
+
+	// Otherwise, reuse the result of the last trace if the capsule has not moved since then.
+
+	const auto& Location{UpdatedComponent->GetComponentLocation()};
+	const auto* MovementBase{GetMovementBase()};
+
+	static constexpr auto CachedTraceLocationTolerance{0.1f};
+
+	if (bSlideSurfaceTraceValid && SlideSurfaceTraceBase == MovementBase &&
+	    SlideSurfaceTraceLocation.Equals(Location, CachedTraceLocationTolerance))
+	{
+		return bSlideSurfaceTraceHit;
+	}
+
+	ALS_COUNT_SCENE_QUERY(CharacterOwner, STAT_Als_SlideSceneQueries, Slide);
+
+	FCollisionQueryParams QueryParameters{SCENE_QUERY_STAT(AlsSlideSurfaceTrace), false, CharacterOwner};
+	FCollisionResponseParams CollisionResponses;
+	InitCollisionParams(QueryParameters, CollisionResponses);
+
+	bSlideSurfaceTraceHit = GetWorld()->LineTraceTestByChannel(
+		Location, Location - FVector::UpVector * (CapsuleHalfHeight * SurfaceTraceLengthMultiplier),
+		UpdatedComponent->GetCollisionObjectType(), QueryParameters, CollisionResponses);
+
+	bSlideSurfaceTraceValid = true;
+	SlideSurfaceTraceLocation = Location;
+	SlideSurfaceTraceBase = MovementBase;
+
+	return bSlideSurfaceTraceHit;
 }
 
 void UAlsCharacterMovementComponent::PhysSlide(float deltaTime, int32 Iterations)
 {
+	ALS_SCOPED_STAGE_STAT(AlsMovement, PhysSlide)
+
 	if (deltaTime < MIN_TICK_TIME)
 	{
 		return;
@@ -0,0 +1,378 @@
+#include "AlsCharacterMovementComponent.h"
+
+#include "AlsCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+#include "Utility/AlsLog.h"
+#include "Utility/AlsMacros.h"
+
+namespace AlsMoveRecording
+{
+	// About 10 minutes of moves at 60 FPS.
+	static constexpr auto MaxRecordedMovesCount{36000};
+
+	static constexpr uint32 FileVersion{2};
+
+	static FString GetDefaultFilePath(const UAlsCharacterMovementComponent& Movement)
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AlsMoves"), Movement.GetOwner()->GetName() + TEXT(".alsmoves"));
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs ConsoleCommandRecordMoves{
+		TEXT("als.Movement.RecordMoves"),
+		TEXT("als.Movement.RecordMoves <0/1>. Starts or stops recording moves received from clients by all ALS characters. ")
+		TEXT("When recording stops, moves of each character are saved to the Saved/AlsMoves directory."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Arguments, UWorld* World)
+		{
+			if (!IsValid(World))
+			{
+				return;
+			}
+
+			const auto bRecord{Arguments.IsEmpty() || FCString::ToBool(*Arguments[0])};
+
+			for (TActorIterator<AAlsCharacter> Iterator{World}; Iterator; ++Iterator)
+			{
+				auto* Movement{Cast<UAlsCharacterMovementComponent>(Iterator->GetCharacterMovement())};
+				if (!IsValid(Movement) || !Iterator->HasAuthority())
+				{
+					continue;
+				}
+
+				if (bRecord)
+				{
+					Movement->ClearRecordedMoves();
+					Movement->SetRecordingMoves(true);
+					continue;
+				}
+
+				Movement->SetRecordingMoves(false);
+
+				if (Movement->GetRecordedMoves().IsEmpty())
+				{
+					continue;
+				}
+
+				const auto FilePath{GetDefaultFilePath(*Movement)};
+
+				if (UAlsCharacterMovementComponent::SaveMovesToFile(Movement->GetRecordedMoves(), FilePath))
+				{
+					UE_LOG(LogAls, Log, TEXT("%d moves of %s saved to %s."),
+					       Movement->GetRecordedMoves().Num(), *Iterator->GetName(), *FilePath);
+				}
+			}
+		})
+	};
+
+	static FAutoConsoleCommandWithWorldAndArgs ConsoleCommandReplayMoves{
+		TEXT("als.Movement.ReplayMoves"),
+		TEXT("als.Movement.ReplayMoves <FilePath> [LocationTolerance]. Replays recorded moves against the first ALS ")
+		TEXT("character with authority and logs the per move CPU cost, floor queries count and mismatches count."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Arguments, UWorld* World)
+		{
+			if (!IsValid(World) || Arguments.IsEmpty())
+			{
+				return;
+			}
+
+			TArray<FAlsRecordedMove> Moves;
+			if (!UAlsCharacterMovementComponent::LoadMovesFromFile(Arguments[0], Moves))
+			{
+				return;
+			}
+
+			const auto LocationTolerance{Arguments.Num() > 1 ? FCString::Atof(*Arguments[1]) : 1.0f};
+
+			for (TActorIterator<AAlsCharacter> Iterator{World}; Iterator; ++Iterator)
+			{
+				auto* Movement{Cast<UAlsCharacterMovementComponent>(Iterator->GetCharacterMovement())};
+				if (!IsValid(Movement) || !Iterator->HasAuthority())
+				{
+					continue;
+				}
+
+				const auto Result{Movement->ReplayMoves(Moves, LocationTolerance)};
+
+				UE_LOG(LogAls, Log, TEXT("Replayed %d moves on %s: average move time %.4f ms, max move time %.4f ms, ")
+				       TEXT("%d floor queries, %d mismatched moves, max location error %.2f cm."),
+				       Result.MovesCount, *Iterator->GetName(), Result.AverageMoveTime, Result.MaxMoveTime,
+				       Result.FloorQueriesCount, Result.MismatchedMovesCount, Result.MaxLocationError);
+				return;
+			}
+
+			UE_LOG(LogAls, Warning, TEXT("No ALS character with authority was found to replay moves."));
+		})
+	};
+}
+
+void UAlsCharacterMovementComponent::SetRecordingMoves(const bool bNewRecordingMoves)
+{
+	bRecordingMoves = bNewRecordingMoves;
+}
+
+void UAlsCharacterMovementComponent::ClearRecordedMoves()
+{
+	RecordedMoves.Reset();
+}
+
+FAlsRecordedMove* UAlsCharacterMovementComponent::StartRecordingMove(const float ClientTimeStamp, const float DeltaTime,
+                                                                     const uint8 CompressedFlags, const FVector& NewAcceleration)
+{
+	if (!HasValidData())
+	{
+		return nullptr;
+	}
+
+	if (RecordedMoves.Num() >= AlsMoveRecording::MaxRecordedMovesCount)
+	{
+		UE_LOG(LogAls, Warning, TEXT("Move recording of %s stopped because the maximum number of moves was reached."),
+		       *GetNameSafe(GetOwner()));
+
+		bRecordingMoves = false;
+		return nullptr;
+	}
+
+	auto& Move{RecordedMoves.Emplace_GetRef()};
+
+	Move.TimeStamp = ClientTimeStamp;
+	Move.DeltaTime = DeltaTime;
+	Move.CompressedFlags = CompressedFlags;
+	Move.Acceleration = NewAcceleration;
+
+	RecordMoveStartState(Move);
+
+	return &Move;
+}
+
+void UAlsCharacterMovementComponent::RecordMoveStartState(FAlsRecordedMove& Move) const
+{
+	Move.StartMovementMode = MovementMode;
+	Move.StartCustomMovementMode = CustomMovementMode;
+	Move.RotationMode = RotationMode;
+	Move.Stance = Stance;
+	Move.MaxAllowedGait = MaxAllowedGait;
+	Move.StartLocation = UpdatedComponent->GetComponentLocation();
+	Move.StartRotation = UpdatedComponent->GetComponentRotation();
+	Move.StartVelocity = Velocity;
+	Move.StartCapsuleHalfHeight = CharacterOwner->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+	Move.bStartCrouched = IsCrouching();
+	Move.bStartProned = IsProning();
+	Move.bStartWantsToCrouch = bWantsToCrouch;
+	Move.bStartWantsToProne = bWantsToProne;
+	Move.bStartPrevWantsToCrouch = Safe_bPrevWantsToCrouch;
+}
+
+void UAlsCharacterMovementComponent::FinishRecordingMove(FAlsRecordedMove& Move) const
+{
+	if (HasValidData())
+	{
+		Move.EndLocation = UpdatedComponent->GetComponentLocation();
+		Move.EndVelocity = Velocity;
+	}
+}
+
+void UAlsCharacterMovementComponent::RestoreRecordedStance(const FAlsRecordedMove& Move)
+{
+	// Apply the recorded capsule size and stance flags directly instead of calling Crouch() or Prone(),
+	// since these also move the capsule and adjust the mesh, while the recorded location already reflects the stance.
+
+	auto* Capsule{CharacterOwner->GetCapsuleComponent()};
+
+	if (Move.StartCapsuleHalfHeight > 0.0f && !FMath::IsNearlyEqual(Capsule->GetUnscaledCapsuleHalfHeight(), Move.StartCapsuleHalfHeight))
+	{
+		Capsule->SetCapsuleSize(Capsule->GetUnscaledCapsuleRadius(), Move.StartCapsuleHalfHeight);
+	}
+
+	CharacterOwner->bIsCrouched = Move.bStartCrouched;
+
+	auto* Character{Cast<AAlsCharacter>(CharacterOwner)};
+	if (IsValid(Character))
+	{
+		Character->SetIsProned(Move.bStartProned);
+	}
+
+	bWantsToCrouch = Move.bStartWantsToCrouch;
+	bWantsToProne = Move.bStartWantsToProne;
+	Safe_bPrevWantsToCrouch = Move.bStartPrevWantsToCrouch;
+
+	// The cached slide surface belongs to the previous move location.
+
+	bSlideSurfaceTraceValid = false;
+	SlideSurfaceTraceBase.Reset();
+
+	// The throttle state is not recorded, so let the replayed move make its own stance exit attempts.
+
+	BlockedStanceExitBase.Reset();
+	BlockedStanceExitCapsuleHalfHeight = 0.0f;
+	BlockedStanceExitRetryTimeRemaining = 0.0f;
+	BlockedStanceExitAttemptsCount = 0;
+
+	bForceNextFloorCheck = true;
+}
+
+void UAlsCharacterMovementComponent::RestoreRecordedMoveStartState(const FAlsRecordedMove& Move)
+{
+	UpdatedComponent->SetWorldLocationAndRotation(Move.StartLocation, Move.StartRotation, false, nullptr, ETeleportType::TeleportPhysics);
+
+	// Entering or exiting the slide changes the crouch input and velocity, so restore them after the movement mode.
+
+	SetMovementMode(static_cast<EMovementMode>(Move.StartMovementMode), Move.StartCustomMovementMode);
+
+	RestoreRecordedStance(Move);
+
+	Velocity = Move.StartVelocity;
+
+	RotationMode = Move.RotationMode;
+	Stance = Move.Stance;
+	MaxAllowedGait = Move.MaxAllowedGait;
+
+	RefreshGaitSettings();
+}
+
+FAlsMoveReplayResult UAlsCharacterMovementComponent::ReplayMoves(const TArray<FAlsRecordedMove>& Moves, const float LocationTolerance)
+{
+	FAlsMoveReplayResult Result;
+
+	if (!ALS_ENSURE(HasValidData()) || !ALS_ENSURE(CharacterOwner->HasAuthority()))
+	{
+		return Result;
+	}
+
+	const auto bPreviousRecordingMoves{bRecordingMoves};
+	bRecordingMoves = false;
+
+	// Replaying overwrites the state of the character, so save it to restore it once all moves are replayed.
+
+	FAlsRecordedMove InitialState;
+	RecordMoveStartState(InitialState);
+
+	const auto InitialAcceleration{Acceleration};
+
+	uint64 TotalMoveCycles{0};
+	uint64 MaxMoveCycles{0};
+
+	for (const auto& Move : Moves)
+	{
+		// Restore the recorded state so that each move is processed independently
+		// of the previous ones, as it would have been on the recording server.
+
+		RestoreRecordedMoveStartState(Move);
+
+		// The floor queries counter is cumulative and is also read by the movement trace, so instead of resetting
+		// it, count only the queries made by this move.
+
+		const auto StartFloorQueriesCount{FloorQueriesCount};
+
+		const auto StartCycles{FPlatformTime::Cycles64()};
+
+		// Skip our own override, since it reads the move data from the current network move,
+		// and process the move the same way the server does after the move data is applied.
+
+		Super::MoveAutonomous(Move.TimeStamp, Move.DeltaTime, Move.CompressedFlags, Move.Acceleration);
+
+		const auto MoveCycles{FPlatformTime::Cycles64() - StartCycles};
+
+		TotalMoveCycles += MoveCycles;
+		MaxMoveCycles = FMath::Max(MaxMoveCycles, MoveCycles);
+
+		Result.FloorQueriesCount += FloorQueriesCount - StartFloorQueriesCount;
+
+		const auto LocationError{UE_REAL_TO_FLOAT(FVector::Dist(UpdatedComponent->GetComponentLocation(), Move.EndLocation))};
+
+		Result.MaxLocationError = FMath::Max(Result.MaxLocationError, LocationError);
+
+		if (LocationError > LocationTolerance)
+		{
+			Result.MismatchedMovesCount += 1;
+		}
+	}
+
+	RestoreRecordedMoveStartState(InitialState);
+	Acceleration = InitialAcceleration;
+
+	bRecordingMoves = bPreviousRecordingMoves;
+
+	Result.MovesCount = Moves.Num();
+
+	if (Result.MovesCount > 0)
+	{
+		Result.AverageMoveTime = UE_REAL_TO_FLOAT(FPlatformTime::ToMilliseconds64(TotalMoveCycles) / Result.MovesCount);
+		Result.MaxMoveTime = UE_REAL_TO_FLOAT(FPlatformTime::ToMilliseconds64(MaxMoveCycles));
+	}
+
+	return Result;
+}
+
+bool UAlsCharacterMovementComponent::SaveMovesToFile(const TArray<FAlsRecordedMove>& Moves, const FString& FilePath)
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer{Data};
+	FNameAsStringProxyArchive Archive{Writer};
+
+	auto Version{AlsMoveRecording::FileVersion};
+	Archive << Version;
+
+	auto MovesCount{Moves.Num()};
+	Archive << MovesCount;
+
+	for (const auto& Move : Moves)
+	{
+		Move.Save(Archive);
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Data, *FilePath))
+	{
+		UE_LOG(LogAls, Warning, TEXT("Failed to save moves to %s."), *FilePath);
+		return false;
+	}
+
+	return true;
+}
+
+bool UAlsCharacterMovementComponent::LoadMovesFromFile(const FString& FilePath, TArray<FAlsRecordedMove>& Moves)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *FilePath))
+	{
+		UE_LOG(LogAls, Warning, TEXT("Failed to load moves from %s."), *FilePath);
+		return false;
+	}
+
+	FMemoryReader Reader{Data};
+	FNameAsStringProxyArchive Archive{Reader};
+
+	uint32 Version{0};
+	Archive << Version;
+
+	if (Version != AlsMoveRecording::FileVersion)
+	{
+		UE_LOG(LogAls, Warning, TEXT("Moves file %s has unsupported version %u."), *FilePath, Version);
+		return false;
+	}
+
+	int32 MovesCount{0};
+	Archive << MovesCount;
+
+	if (MovesCount < 0 || MovesCount > AlsMoveRecording::MaxRecordedMovesCount)
+	{
+		UE_LOG(LogAls, Warning, TEXT("Moves file %s is corrupted."), *FilePath);
+		return false;
+	}
+
+	Moves.Reset(MovesCount);
+
+	for (auto i{0}; i < MovesCount && !Archive.IsError(); i++)
+	{
+		Moves.Emplace_GetRef().Serialize(Archive);
+	}
+
+	return !Archive.IsError();
+}
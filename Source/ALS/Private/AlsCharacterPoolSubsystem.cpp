@@ -0,0 +1,214 @@
+#include "AlsCharacterPoolSubsystem.h"
+
+#include "AlsCharacter.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Controller.h"
+#include "Utility/AlsLog.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCharacterPoolSubsystem)
+
+bool UAlsCharacterPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsCharacterPoolSubsystem::Deinitialize()
+{
+	Pools.Reset();
+
+	Super::Deinitialize();
+}
+
+void UAlsCharacterPoolSubsystem::Prewarm(const TSubclassOf<AAlsCharacter> CharacterClass, const int32 Count)
+{
+	if (!IsValid(CharacterClass) || GetWorld()->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	auto& Pool{Pools.FindOrAdd(CharacterClass)};
+
+	Pool.Characters.RemoveAll([](const FAlsPooledCharacter& PooledCharacter)
+	{
+		return !IsValid(PooledCharacter.Character);
+	});
+
+	Pool.Characters.Reserve(Count);
+
+	while (Pool.Characters.Num() < Count)
+	{
+		auto* Character{SpawnPooledCharacter(CharacterClass, FTransform::Identity)};
+		if (!IsValid(Character))
+		{
+			return;
+		}
+
+		Pool.Characters.Emplace(DeactivateCharacter(*Character));
+	}
+}
+
+AAlsCharacter* UAlsCharacterPoolSubsystem::AcquireCharacter(const TSubclassOf<AAlsCharacter> CharacterClass, const FTransform& Transform)
+{
+	if (!IsValid(CharacterClass) || GetWorld()->GetNetMode() == NM_Client)
+	{
+		return nullptr;
+	}
+
+	FAlsPooledCharacter PooledCharacter;
+
+	auto* Pool{Pools.Find(CharacterClass)};
+	if (Pool != nullptr)
+	{
+		while (!Pool->Characters.IsEmpty() && !IsValid(PooledCharacter.Character))
+		{
+			PooledCharacter = Pool->Characters.Pop(EAllowShrinking::No);
+		}
+	}
+
+	AAlsCharacter* Character;
+
+	if (IsValid(PooledCharacter.Character))
+	{
+		Character = PooledCharacter.Character;
+		Character->TeleportTo(Transform.GetLocation(), Transform.Rotator(), false, true);
+
+		ActivateCharacter(PooledCharacter);
+	}
+	else
+	{
+		// Newly spawned characters are already active.
+
+		Character = SpawnPooledCharacter(CharacterClass, Transform);
+		if (!IsValid(Character))
+		{
+			return nullptr;
+		}
+	}
+
+	const auto* DefaultCharacter{CharacterClass->GetDefaultObject<AAlsCharacter>()};
+
+	if (Character->GetController() == nullptr && (DefaultCharacter->AutoPossessAI == EAutoPossessAI::Spawned ||
+	                                              DefaultCharacter->AutoPossessAI == EAutoPossessAI::PlacedInWorldOrSpawned))
+	{
+		Character->SpawnDefaultController();
+	}
+
+	return Character;
+}
+
+void UAlsCharacterPoolSubsystem::ReleaseCharacter(AAlsCharacter* Character)
+{
+	if (!IsValid(Character) || Character->GetWorld() != GetWorld() || !Character->HasAuthority())
+	{
+		return;
+	}
+
+	auto& Pool{Pools.FindOrAdd(Character->GetClass())};
+
+	if (Pool.Characters.ContainsByPredicate([Character](const FAlsPooledCharacter& PooledCharacter)
+	{
+		return PooledCharacter.Character == Character;
+	}))
+	{
+		return;
+	}
+
+	auto* Controller{Character->GetController()};
+	if (IsValid(Controller))
+	{
+		Controller->UnPossess();
+
+		if (!Controller->IsPlayerController())
+		{
+			Controller->Destroy();
+		}
+	}
+
+	Character->ResetForReuse();
+
+	Pool.Characters.Emplace(DeactivateCharacter(*Character));
+}
+
+int32 UAlsCharacterPoolSubsystem::GetPooledCharactersCount(const TSubclassOf<AAlsCharacter> CharacterClass) const
+{
+	const auto* Pool{Pools.Find(CharacterClass)};
+	return Pool != nullptr ? Pool->Characters.Num() : 0;
+}
+
+AAlsCharacter* UAlsCharacterPoolSubsystem::SpawnPooledCharacter(const TSubclassOf<AAlsCharacter> CharacterClass,
+                                                                const FTransform& Transform) const
+{
+	auto* Character{
+		GetWorld()->SpawnActorDeferred<AAlsCharacter>(CharacterClass, Transform, nullptr, nullptr,
+		                                              ESpawnActorCollisionHandlingMethod::AlwaysSpawn)
+	};
+
+	if (!IsValid(Character))
+	{
+		UE_LOG(LogAls, Warning, TEXT("%hs: Failed to spawn a character of class %s."),
+		       __FUNCTION__, *CharacterClass->GetName());
+		return nullptr;
+	}
+
+	// Controllers are spawned when the character is acquired, not when it is put into the pool.
+
+	Character->AutoPossessAI = EAutoPossessAI::Disabled;
+
+	Character->FinishSpawning(Transform);
+
+	Character->AutoPossessAI = CharacterClass->GetDefaultObject<AAlsCharacter>()->AutoPossessAI;
+
+	return Character;
+}
+
+void UAlsCharacterPoolSubsystem::ActivateCharacter(const FAlsPooledCharacter& PooledCharacter)
+{
+	auto& Character{*PooledCharacter.Character};
+
+	Character.SetActorHiddenInGame(false);
+	Character.SetActorEnableCollision(true);
+	Character.SetActorTickEnabled(PooledCharacter.bActorTickEnabled);
+
+	for (auto* Component : PooledCharacter.TickEnabledComponents)
+	{
+		if (IsValid(Component))
+		{
+			Component->SetComponentTickEnabled(true);
+		}
+	}
+
+	Character.GetCharacterMovement()->SetDefaultMovementMode();
+
+	Character.SetNetDormancy(DORM_Awake);
+	Character.ForceNetUpdate();
+}
+
+FAlsPooledCharacter UAlsCharacterPoolSubsystem::DeactivateCharacter(AAlsCharacter& Character)
+{
+	FAlsPooledCharacter PooledCharacter;
+	PooledCharacter.Character = &Character;
+	PooledCharacter.bActorTickEnabled = Character.IsActorTickEnabled();
+
+	Character.SetActorHiddenInGame(true);
+	Character.SetActorEnableCollision(false);
+	Character.SetActorTickEnabled(false);
+
+	for (auto* Component : Character.GetComponents())
+	{
+		if (IsValid(Component) && Component->IsComponentTickEnabled())
+		{
+			PooledCharacter.TickEnabledComponents.Emplace(Component);
+			Component->SetComponentTickEnabled(false);
+		}
+	}
+
+	Character.GetCharacterMovement()->DisableMovement();
+
+	// Send the hidden state to clients before the character goes dormant.
+
+	Character.ForceNetUpdate();
+	Character.SetNetDormancy(DORM_DormantAll);
+
+	return PooledCharacter;
+}
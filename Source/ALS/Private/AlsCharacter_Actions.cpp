@@ -17,6 +17,8 @@
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsMontageUtility.h"
 #include "Utility/AlsRotation.h"
+#include "Utility/AlsSkeletalMeshData.h"
+#include "Utility/AlsStats.h"
 #include "Utility/AlsVector.h"
 
 void AAlsCharacter::StartRolling(const float PlayRate)
@@ -73,6 +75,8 @@ UAnimMontage* AAlsCharacter::SelectRollMontage_Implementation()
 void AAlsCharacter::ServerStartRolling_Implementation(UAnimMontage* Montage, const float PlayRate,
                                                       const float InitialYawAngle, const float TargetYawAngle)
 {
+	ALS_COUNT_SERVER_RPC(ServerStartRolling);
+
 	if (IsRollingAllowedToStart(Montage))
 	{
 		MulticastStartRolling(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
@@ -83,6 +87,8 @@ void AAlsCharacter::ServerStartRolling_Implementation(UAnimMontage* Montage, con
 void AAlsCharacter::MulticastStartRolling_Implementation(UAnimMontage* Montage, const float PlayRate,
                                                          const float InitialYawAngle, const float TargetYawAngle)
 {
+	ALS_COUNT_MULTICAST_RPC(this, MulticastStartRolling);
+
 	StartRollingImplementation(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
 }
 
@@ -101,6 +107,8 @@ void AAlsCharacter::StartRollingImplementation(UAnimMontage* Montage, const floa
 
 void AAlsCharacter::RefreshRolling(const float DeltaTime)
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshRolling)
+
 	if (GetLocalRole() <= ROLE_SimulatedProxy ||
 	    GetMesh()->GetAnimInstance()->RootMotionMode <= ERootMotionMode::IgnoreRootMotion)
 	{
@@ -145,6 +153,8 @@ bool AAlsCharacter::StartMantlingGrounded()
 
 bool AAlsCharacter::StartMantlingInAir()
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, StartMantlingInAir)
+
 	return LocomotionMode == AlsLocomotionModeTags::InAir && IsLocallyControlled() &&
 	       StartMantling(Settings->Mantling.InAirTrace);
 }
@@ -217,6 +227,8 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 
 	const auto ForwardTraceCapsuleHalfHeight{LedgeHeightDelta * 0.5f};
 
+	ALS_COUNT_SCENE_QUERY(this, STAT_Als_MantlingSceneQueries, Mantling);
+
 	FHitResult ForwardTraceHit;
 	GetWorld()->SweepSingleByChannel(ForwardTraceHit, ForwardTraceStart, ForwardTraceEnd,
 	                                 FQuat::Identity, Settings->Mantling.MantlingTraceChannel,
@@ -264,6 +276,8 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 		TraceSettings.LedgeHeight.GetMin() * CapsuleScale + TraceCapsuleRadius - UCharacterMovementComponent::MAX_FLOOR_DIST
 	};
 
+	ALS_COUNT_SCENE_QUERY(this, STAT_Als_MantlingSceneQueries, Mantling);
+
 	FHitResult DownwardTraceHit;
 	GetWorld()->SweepSingleByChannel(DownwardTraceHit, DownwardTraceStart, DownwardTraceEnd, FQuat::Identity,
 	                                 Settings->Mantling.MantlingTraceChannel, FCollisionShape::MakeSphere(TraceCapsuleRadius),
@@ -312,6 +326,8 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 
 	const FVector TargetCapsuleLocation{TargetLocation.X, TargetLocation.Y, TargetLocation.Z + CapsuleHalfHeight};
 
+	ALS_COUNT_SCENE_QUERY(this, STAT_Als_MantlingSceneQueries, Mantling);
+
 	if (GetWorld()->OverlapBlockingTestByChannel(TargetCapsuleLocation, FQuat::Identity, Settings->Mantling.MantlingTraceChannel,
 	                                             FCollisionShape::MakeCapsule(CapsuleRadius, CapsuleHalfHeight),
 	                                             {TargetLocationTraceTag, false, this}, Settings->Mantling.MantlingTraceResponses))
@@ -352,6 +368,8 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 		UE_REAL_TO_FLOAT(DownwardTraceHit.Location.Z - DownwardTraceEnd.Z) * 0.5f + TraceCapsuleRadius
 	};
 
+	ALS_COUNT_SCENE_QUERY(this, STAT_Als_MantlingSceneQueries, Mantling);
+
 	if (GetWorld()->OverlapBlockingTestByChannel(StartLocation, FQuat::Identity, Settings->Mantling.MantlingTraceChannel,
 	                                             FCollisionShape::MakeCapsule(TraceCapsuleRadius, StartLocationTraceCapsuleHalfHeight),
 	                                             {StartLocationTraceTag, false, this}, Settings->Mantling.MantlingTraceResponses))
@@ -439,6 +457,8 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 
 void AAlsCharacter::ServerStartMantling_Implementation(const FAlsMantlingParameters& Parameters)
 {
+	ALS_COUNT_SERVER_RPC(ServerStartMantling);
+
 	if (IsMantlingAllowedToStart())
 	{
 		MulticastStartMantling(Parameters);
@@ -448,6 +468,8 @@ void AAlsCharacter::ServerStartMantling_Implementation(const FAlsMantlingParamet
 
 void AAlsCharacter::MulticastStartMantling_Implementation(const FAlsMantlingParameters& Parameters)
 {
+	ALS_COUNT_MULTICAST_RPC(this, MulticastStartMantling);
+
 	StartMantlingImplementation(Parameters);
 }
 
@@ -627,6 +649,8 @@ void AAlsCharacter::OnMantlingStarted_Implementation(const FAlsMantlingParameter
 
 void AAlsCharacter::RefreshMantling()
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshMantling)
+
 	if (MantlingState.RootMotionSourceId <= 0)
 	{
 		return;
@@ -726,6 +750,8 @@ void AAlsCharacter::StartRagdolling()
 
 void AAlsCharacter::ServerStartRagdolling_Implementation()
 {
+	ALS_COUNT_SERVER_RPC(ServerStartRagdolling);
+
 	if (IsRagdollingAllowedToStart())
 	{
 		MulticastStartRagdolling();
@@ -735,6 +761,8 @@ void AAlsCharacter::ServerStartRagdolling_Implementation()
 
 void AAlsCharacter::MulticastStartRagdolling_Implementation()
 {
+	ALS_COUNT_MULTICAST_RPC(this, MulticastStartRagdolling);
+
 	StartRagdollingImplementation();
 }
 
@@ -779,6 +807,16 @@ void AAlsCharacter::StartRagdollingImplementation()
 	// TODO Check the need for this in future engine versions.
 	GetMesh()->ResetAllBodiesSimulatePhysics();
 
+	if (GetMesh()->bDeferKinematicBoneUpdate)
+	{
+		// Kinematic bodies have no velocity when their update is deferred, so the ragdoll
+		// will not inherit the character's velocity on its own. Pass it to the ragdoll manually.
+
+		GetMesh()->SetAllPhysicsLinearVelocity(GetVelocity());
+	}
+
+	const auto bFullPoseReplicated{IsRagdollFullPoseReplicated()};
+
 	const auto* PelvisBody{GetMesh()->GetBodyInstance(UAlsConstants::PelvisBoneName())};
 	FVector PelvisLocation;
 
@@ -808,9 +846,15 @@ void AAlsCharacter::StartRagdollingImplementation()
 	if (GetLocalRole() >= ROLE_Authority)
 	{
 		SetRagdollTargetLocation(FVector::ZeroVector);
+
+		RagdollingState.FullPoseReplicationTimeRemaining = 0.0f;
 	}
 
-	if (IsLocallyControlled() || (GetLocalRole() >= ROLE_Authority && !IsValid(GetController())))
+	// When the full pose is replicated, the authority is the only one who simulates the ragdoll.
+
+	if (bFullPoseReplicated
+		    ? GetLocalRole() >= ROLE_Authority
+		    : IsLocallyControlled() || (GetLocalRole() >= ROLE_Authority && !IsValid(GetController())))
 	{
 		SetRagdollTargetLocation(PelvisLocation);
 	}
@@ -822,6 +866,14 @@ void AAlsCharacter::StartRagdollingImplementation()
 
 	SetLocomotionAction(AlsLocomotionActionTags::Ragdolling);
 
+	// Start the interpolation only after the locomotion action is set, otherwise the pose received
+	// before the ragdolling started will be ignored by the OnReplicated_RagdollPose() function.
+
+	if (bFullPoseReplicated && GetLocalRole() < ROLE_Authority)
+	{
+		StartRagdollFullPoseInterpolation();
+	}
+
 	OnRagdollingStarted();
 }
 
@@ -846,11 +898,252 @@ void AAlsCharacter::SetRagdollTargetLocation(const FVector& NewTargetLocation)
 
 void AAlsCharacter::ServerSetRagdollTargetLocation_Implementation(const FVector_NetQuantize& NewTargetLocation)
 {
+	ALS_COUNT_SERVER_RPC(ServerSetRagdollTargetLocation);
+
 	SetRagdollTargetLocation(NewTargetLocation);
 }
 
+bool AAlsCharacter::IsRagdollFullPoseReplicated() const
+{
+	return bReplicateRagdoll && IsValid(Settings) && Settings->Ragdolling.bReplicateFullPose;
+}
+
+void AAlsCharacter::StartRagdollFullPoseInterpolation()
+{
+	// Full pose bodies are moved kinematically, so make sure that the mesh
+	// reads their transforms from physics even though they are not simulated.
+
+	GetMesh()->bBlendPhysics = true;
+
+	const auto& BodyNames{Settings->Ragdolling.FullPoseBodyNames};
+
+	RagdollingState.FullPoseSourceTransforms.Reset(BodyNames.Num());
+	RagdollingState.FullPoseTargetTransforms.Reset(BodyNames.Num());
+
+	for (const auto& BodyName : BodyNames)
+	{
+		auto* Body{GetMesh()->GetBodyInstance(BodyName)};
+		if (Body == nullptr)
+		{
+			RagdollingState.FullPoseSourceTransforms.Add(FTransform::Identity);
+			RagdollingState.FullPoseTargetTransforms.Add(FTransform::Identity);
+			continue;
+		}
+
+		Body->SetInstanceSimulatePhysics(false);
+
+		const auto BodyTransform{Body->GetUnrealWorldTransform()};
+
+		RagdollingState.FullPoseSourceTransforms.Add(BodyTransform);
+		RagdollingState.FullPoseTargetTransforms.Add(BodyTransform);
+	}
+
+	// Bodies that are not replicated must not be simulated either, otherwise they will fall apart from the
+	// replicated bodies, so make them kinematic and let them follow their closest replicated ancestor body.
+
+	RagdollingState.FullPoseFollowerBodies.Reset();
+
+	const auto& ReferenceSkeleton{GetMesh()->GetSkinnedAsset()->GetRefSkeleton()};
+
+	for (auto i{0}; i < GetMesh()->Bodies.Num() && !BodyNames.IsEmpty(); i++)
+	{
+		auto* Body{GetMesh()->Bodies[i]};
+		if (Body == nullptr || BodyNames.Contains(GetMesh()->GetBoneName(Body->InstanceBoneIndex)))
+		{
+			continue;
+		}
+
+		Body->SetInstanceSimulatePhysics(false);
+
+		auto ParentPoseBodyIndex{INDEX_NONE};
+
+		for (auto ParentBoneIndex{ReferenceSkeleton.GetParentIndex(Body->InstanceBoneIndex)};
+		     ParentBoneIndex >= 0 && ParentPoseBodyIndex < 0;
+		     ParentBoneIndex = ReferenceSkeleton.GetParentIndex(ParentBoneIndex))
+		{
+			ParentPoseBodyIndex = BodyNames.IndexOfByKey(ReferenceSkeleton.GetBoneName(ParentBoneIndex));
+		}
+
+		// Bodies without a replicated ancestor follow the root body.
+
+		if (ParentPoseBodyIndex < 0)
+		{
+			ParentPoseBodyIndex = 0;
+		}
+
+		if (GetMesh()->GetBodyInstance(BodyNames[ParentPoseBodyIndex]) == nullptr)
+		{
+			continue;
+		}
+
+		auto& FollowerBody{RagdollingState.FullPoseFollowerBodies.Emplace_GetRef()};
+		FollowerBody.BodyIndex = i;
+		FollowerBody.ParentPoseBodyIndex = ParentPoseBodyIndex;
+		FollowerBody.RelativeTransform = Body->GetUnrealWorldTransform().GetRelativeTransform(
+			RagdollingState.FullPoseTargetTransforms[ParentPoseBodyIndex]);
+	}
+
+	RagdollingState.FullPoseInterpolationAmount = 1.0f;
+
+	// The first pose may have been received before the ragdolling started.
+
+	if (!RagdollPose.Bodies.IsEmpty())
+	{
+		OnReplicated_RagdollPose();
+	}
+}
+
+void AAlsCharacter::RefreshRagdollFullPose(const float DeltaTime)
+{
+	const auto& BodyNames{Settings->Ragdolling.FullPoseBodyNames};
+	if (BodyNames.IsEmpty())
+	{
+		return;
+	}
+
+	if (GetLocalRole() >= ROLE_Authority)
+	{
+		RagdollingState.FullPoseReplicationTimeRemaining -= DeltaTime;
+		if (RagdollingState.FullPoseReplicationTimeRemaining > 0.0f)
+		{
+			return;
+		}
+
+		const auto ReplicationInterval{1.0f / FMath::Max(1.0f, Settings->Ragdolling.FullPoseReplicationRate)};
+
+		RagdollingState.FullPoseReplicationTimeRemaining = FMath::Max(
+			0.0f, RagdollingState.FullPoseReplicationTimeRemaining + ReplicationInterval);
+
+		const auto* RootBody{GetMesh()->GetBodyInstance(BodyNames[0])};
+		if (RootBody == nullptr)
+		{
+			return;
+		}
+
+		const auto RootLocation{RootBody->GetUnrealWorldTransform().GetLocation()};
+
+		auto bChanged{RagdollPose.Bodies.Num() != BodyNames.Num()};
+
+		const FVector_NetQuantize NewRootLocation{
+			FMath::RoundToDouble(RootLocation.X), FMath::RoundToDouble(RootLocation.Y), FMath::RoundToDouble(RootLocation.Z)
+		};
+
+		if (RagdollPose.RootLocation != NewRootLocation)
+		{
+			RagdollPose.RootLocation = NewRootLocation;
+			bChanged = true;
+		}
+
+		RagdollPose.Bodies.SetNum(BodyNames.Num());
+
+		for (auto i{0}; i < BodyNames.Num(); i++)
+		{
+			const auto* Body{GetMesh()->GetBodyInstance(BodyNames[i])};
+			if (Body == nullptr)
+			{
+				continue;
+			}
+
+			const auto BodyTransform{Body->GetUnrealWorldTransform()};
+
+			FAlsRagdollBodyPose NewBodyPose;
+			NewBodyPose.Location = BodyTransform.GetLocation() - RagdollPose.RootLocation;
+			NewBodyPose.Rotation = BodyTransform.Rotator();
+			NewBodyPose.Quantize();
+
+			// Only bodies that have actually changed will be sent over the network.
+
+			auto& BodyPose{RagdollPose.Bodies[i]};
+
+			if (BodyPose.Location != NewBodyPose.Location || BodyPose.Rotation != NewBodyPose.Rotation)
+			{
+				BodyPose = NewBodyPose;
+				bChanged = true;
+			}
+		}
+
+		if (bChanged)
+		{
+			MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, RagdollPose, this)
+		}
+
+		return;
+	}
+
+	if (RagdollingState.FullPoseTargetTransforms.Num() != BodyNames.Num())
+	{
+		return;
+	}
+
+	// Interpolate between the last two received poses over the replication interval.
+
+	RagdollingState.FullPoseInterpolationAmount = UAlsMath::Clamp01(
+		RagdollingState.FullPoseInterpolationAmount + DeltaTime * Settings->Ragdolling.FullPoseReplicationRate);
+
+	TArray<FTransform, TInlineAllocator<32>> BodyTransforms;
+	BodyTransforms.SetNumUninitialized(BodyNames.Num());
+
+	for (auto i{0}; i < BodyNames.Num(); i++)
+	{
+		auto& BodyTransform{BodyTransforms[i]};
+		BodyTransform.Blend(RagdollingState.FullPoseSourceTransforms[i], RagdollingState.FullPoseTargetTransforms[i],
+		                    RagdollingState.FullPoseInterpolationAmount);
+
+		auto* Body{GetMesh()->GetBodyInstance(BodyNames[i])};
+		if (Body != nullptr)
+		{
+			Body->SetBodyTransform(BodyTransform, ETeleportType::None);
+		}
+	}
+
+	for (const auto& FollowerBody : RagdollingState.FullPoseFollowerBodies)
+	{
+		auto* Body{
+			GetMesh()->Bodies.IsValidIndex(FollowerBody.BodyIndex) ? GetMesh()->Bodies[FollowerBody.BodyIndex] : nullptr
+		};
+
+		if (Body != nullptr)
+		{
+			Body->SetBodyTransform(FollowerBody.RelativeTransform * BodyTransforms[FollowerBody.ParentPoseBodyIndex],
+			                       ETeleportType::None);
+		}
+	}
+}
+
+void AAlsCharacter::OnReplicated_RagdollPose()
+{
+	if (LocomotionAction != AlsLocomotionActionTags::Ragdolling || !IsRagdollFullPoseReplicated() ||
+	    RagdollPose.Bodies.Num() != RagdollingState.FullPoseTargetTransforms.Num())
+	{
+		return;
+	}
+
+	// The target location is not replicated to the owner, so restore it from the pose, since it is used to place the capsule.
+
+	RagdollTargetLocation = RagdollPose.RootLocation;
+
+	// Start a new interpolation from the current interpolated pose.
+
+	for (auto i{0}; i < RagdollPose.Bodies.Num(); i++)
+	{
+		auto& SourceTransform{RagdollingState.FullPoseSourceTransforms[i]};
+		auto& TargetTransform{RagdollingState.FullPoseTargetTransforms[i]};
+
+		SourceTransform.Blend(SourceTransform, TargetTransform, RagdollingState.FullPoseInterpolationAmount);
+
+		const auto& BodyPose{RagdollPose.Bodies[i]};
+
+		TargetTransform.SetLocation(RagdollPose.RootLocation + BodyPose.Location);
+		TargetTransform.SetRotation(BodyPose.Rotation.Quaternion());
+	}
+
+	RagdollingState.FullPoseInterpolationAmount = 0.0f;
+}
+
 void AAlsCharacter::RefreshRagdolling(const float DeltaTime)
 {
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RefreshRagdolling)
+
 	if (LocomotionAction != AlsLocomotionActionTags::Ragdolling)
 	{
 		return;
@@ -868,13 +1161,24 @@ void AAlsCharacter::RefreshRagdolling(const float DeltaTime)
 		RagdollingState.Velocity = FPhysicsInterface::GetLinearVelocity_AssumesLocked(ActorHandle);
 	});
 
-	const auto bLocallyControlled{IsLocallyControlled() || (GetLocalRole() >= ROLE_Authority && !IsValid(GetController()))};
+	const auto bFullPoseReplicated{IsRagdollFullPoseReplicated()};
+
+	const auto bLocallyControlled{
+		bFullPoseReplicated
+			? GetLocalRole() >= ROLE_Authority
+			: IsLocallyControlled() || (GetLocalRole() >= ROLE_Authority && !IsValid(GetController()))
+	};
 
 	if (bLocallyControlled)
 	{
 		SetRagdollTargetLocation(PelvisLocation);
 	}
 
+	if (bFullPoseReplicated)
+	{
+		RefreshRagdollFullPose(DeltaTime);
+	}
+
 	// Prevent the capsule from going through the ground when the ragdoll is lying on the ground.
 
 	// While we could get rid of the line trace here and just use RagdollTargetLocation
@@ -886,7 +1190,7 @@ void AAlsCharacter::RefreshRagdolling(const float DeltaTime)
 
 	// Zero target location means that it hasn't been replicated yet, so we can't apply the logic below.
 
-	if (bReplicateRagdoll && !bLocallyControlled && !RagdollTargetLocation.IsZero())
+	if (bReplicateRagdoll && !bFullPoseReplicated && !bLocallyControlled && !RagdollTargetLocation.IsZero())
 	{
 		// Apply ragdoll location corrections.
 
@@ -963,6 +1267,8 @@ FVector AAlsCharacter::RagdollTraceGround(bool& bGrounded) const
 	FCollisionResponseParams CollisionResponses;
 	GetCharacterMovement()->InitCollisionParams(QueryParameters, CollisionResponses);
 
+	ALS_COUNT_SCENE_QUERY(this, STAT_Als_RagdollingSceneQueries, Ragdolling);
+
 	FHitResult Hit;
 	bGrounded = GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity,
 	                                             CollisionChannel, FCollisionShape::MakeSphere(CapsuleRadius),
@@ -1033,6 +1339,8 @@ bool AAlsCharacter::StopRagdolling()
 
 void AAlsCharacter::ServerStopRagdolling_Implementation()
 {
+	ALS_COUNT_SERVER_RPC(ServerStopRagdolling);
+
 	if (IsRagdollingAllowedToStop())
 	{
 		MulticastStopRagdolling();
@@ -1042,6 +1350,8 @@ void AAlsCharacter::ServerStopRagdolling_Implementation()
 
 void AAlsCharacter::MulticastStopRagdolling_Implementation()
 {
+	ALS_COUNT_MULTICAST_RPC(this, MulticastStopRagdolling);
+
 	StopRagdollingImplementation();
 }
 
@@ -1063,6 +1373,26 @@ void AAlsCharacter::StopRagdollingImplementation()
 
 	GetMesh()->SetSimulatePhysics(false);
 	GetMesh()->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+
+	if (IsRagdollFullPoseReplicated())
+	{
+		if (GetLocalRole() >= ROLE_Authority)
+		{
+			RagdollPose.RootLocation = FVector::ZeroVector;
+			RagdollPose.Bodies.Reset();
+
+			MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, RagdollPose, this)
+		}
+		else
+		{
+			GetMesh()->bBlendPhysics = false;
+		}
+
+		RagdollingState.FullPoseSourceTransforms.Reset();
+		RagdollingState.FullPoseTargetTransforms.Reset();
+		RagdollingState.FullPoseFollowerBodies.Reset();
+	}
+
 	GetMesh()->SetCollisionObjectType(ECC_Pawn);
 
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
@@ -1107,9 +1437,7 @@ void AAlsCharacter::StopRagdollingImplementation()
 	// Restore the pelvis transform to the state it was in before we changed
 	// the character and mesh transforms to keep its world transform unchanged.
 
-	const auto& ReferenceSkeleton{GetMesh()->GetSkinnedAsset()->GetRefSkeleton()};
-
-	const auto PelvisBoneIndex{ReferenceSkeleton.FindBoneIndex(UAlsConstants::PelvisBoneName())};
+	const auto PelvisBoneIndex{FAlsSkeletalMeshData::Get(*GetMesh()->GetSkinnedAsset())->PelvisBoneIndex};
 	if (ALS_ENSURE(PelvisBoneIndex >= 0))
 	{
 		// We expect the pelvis bone to be the root bone or attached to it, so we can safely use the mesh transform here.
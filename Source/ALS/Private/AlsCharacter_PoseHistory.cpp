@@ -0,0 +1,66 @@
+#include "AlsCharacter.h"
+
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Settings/AlsCharacterSettings.h"
+#include "Utility/AlsStats.h"
+
+bool AAlsCharacter::TryGetHistoricalPose(const double Time, FTransform& CapsuleTransform, float& CapsuleHalfHeight,
+                                         TArray<FTransform>& BoneTransforms) const
+{
+	return PoseHistory.TryGetPose(Time, CapsuleTransform, CapsuleHalfHeight, BoneTransforms);
+}
+
+void AAlsCharacter::StartPoseHistoryRecording()
+{
+	if (!IsValid(Settings) || !Settings->PoseHistory.bEnabled || GetLocalRole() != ROLE_Authority || IsNetMode(NM_Standalone))
+	{
+		return;
+	}
+
+	PoseHistory.Initialize(*GetMesh(), Settings->PoseHistory);
+
+	// Frames are recorded from the character tick, since the pose may never be refreshed on a dedicated server, and bones
+	// are sampled only when the pose is refreshed. The mesh is ticked after the character, so the bones of a frame are
+	// refreshed later in the same frame, and until then they are taken from the previously refreshed pose.
+
+	RecordPoseHistoryBones();
+
+	PoseHistoryRecordingHandle = GetMesh()->RegisterOnBoneTransformsFinalizedDelegate(
+		FOnBoneTransformsFinalizedMultiCast::FDelegate::CreateUObject(this, &ThisClass::RecordPoseHistoryBones));
+}
+
+void AAlsCharacter::StopPoseHistoryRecording()
+{
+	if (PoseHistoryRecordingHandle.IsValid())
+	{
+		GetMesh()->UnregisterOnBoneTransformsFinalizedDelegate(PoseHistoryRecordingHandle);
+		PoseHistoryRecordingHandle.Reset();
+	}
+
+	PoseHistory.Reset();
+}
+
+void AAlsCharacter::RecordPoseHistory()
+{
+	if (!PoseHistory.IsInitialized())
+	{
+		return;
+	}
+
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RecordPoseHistory)
+
+	const auto* Capsule{GetCapsuleComponent()};
+
+	PoseHistory.Record(GetWorld()->GetTimeSeconds(), Capsule->GetComponentTransform(), Capsule->GetScaledCapsuleHalfHeight());
+}
+
+void AAlsCharacter::RecordPoseHistoryBones()
+{
+	ALS_SCOPED_STAGE_STAT(AlsCharacter, RecordPoseHistoryBones)
+
+	const auto* Capsule{GetCapsuleComponent()};
+
+	PoseHistory.RecordBones(GetWorld()->GetTimeSeconds(), Capsule->GetComponentTransform(),
+	                        Capsule->GetScaledCapsuleHalfHeight(), *GetMesh());
+}
@@ -0,0 +1,217 @@
+#include "Net/AlsRagdollBodyPoseNetSerializer.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsRagdollBodyPoseNetSerializer)
+
+#if UE_WITH_IRIS
+
+#include "Iris/ReplicationState/PropertyNetSerializerInfoRegistry.h"
+#include "Iris/Serialization/BitPacking.h"
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializerDelegates.h"
+#include "State/AlsRagdollPose.h"
+
+namespace UE::Net
+{
+	struct FAlsRagdollBodyPoseNetSerializer
+	{
+		struct FQuantizedType
+		{
+			// Location components in 0.1 cm units, same as SerializePackedVector<10, 24>().
+			int32 Location[3];
+
+			// Rotation components compressed to 16 bits, same as FRotator::SerializeCompressedShort().
+			uint16 Rotation[3];
+		};
+
+		using SourceType = FAlsRagdollBodyPose;
+		using QuantizedType = FQuantizedType;
+		using ConfigType = FAlsRagdollBodyPoseNetSerializerConfig;
+
+		static constexpr uint32 Version{0};
+
+		static const ConfigType DefaultConfig;
+
+		static constexpr auto LocationScale{10.0};
+
+		// Matches the value range of SerializePackedVector<10, 24>().
+		static constexpr auto MaxQuantizedLocation{(1 << 23) - 1};
+
+		static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Arguments);
+
+		static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Arguments);
+
+		static void SerializeDelta(FNetSerializationContext& Context, const FNetSerializeDeltaArgs& Arguments);
+
+		static void DeserializeDelta(FNetSerializationContext& Context, const FNetDeserializeDeltaArgs& Arguments);
+
+		static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Arguments);
+
+		static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Arguments);
+
+		static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Arguments);
+
+		static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Arguments);
+
+	private:
+		class FNetSerializerRegistryDelegates final : private UE::Net::FNetSerializerRegistryDelegates
+		{
+		public:
+			virtual ~FNetSerializerRegistryDelegates() override;
+
+		private:
+			virtual void OnPreFreezeNetSerializerRegistry() override;
+		};
+
+		static FNetSerializerRegistryDelegates NetSerializerRegistryDelegates;
+	};
+
+	UE_NET_IMPLEMENT_SERIALIZER(FAlsRagdollBodyPoseNetSerializer);
+
+	const FAlsRagdollBodyPoseNetSerializer::ConfigType FAlsRagdollBodyPoseNetSerializer::DefaultConfig;
+
+	FAlsRagdollBodyPoseNetSerializer::FNetSerializerRegistryDelegates FAlsRagdollBodyPoseNetSerializer::NetSerializerRegistryDelegates;
+
+	static const FName PropertyNetSerializerRegistry_NAME_AlsRagdollBodyPose{TEXTVIEW("AlsRagdollBodyPose")};
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AlsRagdollBodyPose, FAlsRagdollBodyPoseNetSerializer);
+
+	void FAlsRagdollBodyPoseNetSerializer::Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Arguments)
+	{
+		const auto& Value{*reinterpret_cast<const QuantizedType*>(Arguments.Source)};
+		auto* Writer{Context.GetBitStreamWriter()};
+
+		for (const auto Component : Value.Location)
+		{
+			WritePackedInt32(Writer, Component);
+		}
+
+		for (const auto Component : Value.Rotation)
+		{
+			Writer->WriteBits(Component, 16);
+		}
+	}
+
+	void FAlsRagdollBodyPoseNetSerializer::Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Arguments)
+	{
+		auto& Value{*reinterpret_cast<QuantizedType*>(Arguments.Target)};
+		auto* Reader{Context.GetBitStreamReader()};
+
+		for (auto& Component : Value.Location)
+		{
+			Component = ReadPackedInt32(Reader);
+		}
+
+		for (auto& Component : Value.Rotation)
+		{
+			Component = static_cast<uint16>(Reader->ReadBits(16));
+		}
+	}
+
+	void FAlsRagdollBodyPoseNetSerializer::SerializeDelta(FNetSerializationContext& Context, const FNetSerializeDeltaArgs& Arguments)
+	{
+		const auto& Value{*reinterpret_cast<const QuantizedType*>(Arguments.Source)};
+		const auto& PreviousValue{*reinterpret_cast<const QuantizedType*>(Arguments.Prev)};
+		auto* Writer{Context.GetBitStreamWriter()};
+
+		// Ragdoll bodies usually move only a little between updates, so write
+		// location deltas and skip rotation components that have not changed.
+
+		for (auto i{0}; i < 3; i++)
+		{
+			WritePackedInt32(Writer, Value.Location[i] - PreviousValue.Location[i]);
+		}
+
+		for (auto i{0}; i < 3; i++)
+		{
+			if (Writer->WriteBool(Value.Rotation[i] != PreviousValue.Rotation[i]))
+			{
+				Writer->WriteBits(Value.Rotation[i], 16);
+			}
+		}
+	}
+
+	void FAlsRagdollBodyPoseNetSerializer::DeserializeDelta(FNetSerializationContext& Context, const FNetDeserializeDeltaArgs& Arguments)
+	{
+		auto& Value{*reinterpret_cast<QuantizedType*>(Arguments.Target)};
+		const auto& PreviousValue{*reinterpret_cast<const QuantizedType*>(Arguments.Prev)};
+		auto* Reader{Context.GetBitStreamReader()};
+
+		for (auto i{0}; i < 3; i++)
+		{
+			Value.Location[i] = PreviousValue.Location[i] + ReadPackedInt32(Reader);
+		}
+
+		for (auto i{0}; i < 3; i++)
+		{
+			Value.Rotation[i] = Reader->ReadBool() ? static_cast<uint16>(Reader->ReadBits(16)) : PreviousValue.Rotation[i];
+		}
+	}
+
+	void FAlsRagdollBodyPoseNetSerializer::Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Arguments)
+	{
+		const auto& Source{*reinterpret_cast<const SourceType*>(Arguments.Source)};
+		auto& Target{*reinterpret_cast<QuantizedType*>(Arguments.Target)};
+
+		for (auto i{0}; i < 3; i++)
+		{
+			Target.Location[i] = FMath::Clamp(FMath::RoundToInt32(Source.Location[i] * LocationScale),
+			                                  -MaxQuantizedLocation, MaxQuantizedLocation);
+		}
+
+		Target.Rotation[0] = FRotator::CompressAxisToShort(Source.Rotation.Pitch);
+		Target.Rotation[1] = FRotator::CompressAxisToShort(Source.Rotation.Yaw);
+		Target.Rotation[2] = FRotator::CompressAxisToShort(Source.Rotation.Roll);
+	}
+
+	void FAlsRagdollBodyPoseNetSerializer::Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Arguments)
+	{
+		const auto& Source{*reinterpret_cast<const QuantizedType*>(Arguments.Source)};
+		auto& Target{*reinterpret_cast<SourceType*>(Arguments.Target)};
+
+		for (auto i{0}; i < 3; i++)
+		{
+			Target.Location[i] = Source.Location[i] / LocationScale;
+		}
+
+		// Keep the rotation in the same range as FRotator::SerializeCompressedShort().
+
+		Target.Rotation.Pitch = FRotator::DecompressAxisFromShort(Source.Rotation[0]);
+		Target.Rotation.Yaw = FRotator::DecompressAxisFromShort(Source.Rotation[1]);
+		Target.Rotation.Roll = FRotator::DecompressAxisFromShort(Source.Rotation[2]);
+	}
+
+	bool FAlsRagdollBodyPoseNetSerializer::IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Arguments)
+	{
+		if (Arguments.bStateIsQuantized)
+		{
+			const auto& Value0{*reinterpret_cast<const QuantizedType*>(Arguments.Source0)};
+			const auto& Value1{*reinterpret_cast<const QuantizedType*>(Arguments.Source1)};
+
+			return FMemory::Memcmp(&Value0, &Value1, sizeof(QuantizedType)) == 0;
+		}
+
+		const auto& Value0{*reinterpret_cast<const SourceType*>(Arguments.Source0)};
+		const auto& Value1{*reinterpret_cast<const SourceType*>(Arguments.Source1)};
+
+		return Value0.Location == Value1.Location && Value0.Rotation == Value1.Rotation;
+	}
+
+	bool FAlsRagdollBodyPoseNetSerializer::Validate(FNetSerializationContext& Context, const FNetValidateArgs& Arguments)
+	{
+		const auto& Source{*reinterpret_cast<const SourceType*>(Arguments.Source)};
+
+		return !Source.Location.ContainsNaN() && !Source.Rotation.ContainsNaN();
+	}
+
+	FAlsRagdollBodyPoseNetSerializer::FNetSerializerRegistryDelegates::~FNetSerializerRegistryDelegates()
+	{
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AlsRagdollBodyPose);
+	}
+
+	void FAlsRagdollBodyPoseNetSerializer::FNetSerializerRegistryDelegates::OnPreFreezeNetSerializerRegistry()
+	{
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AlsRagdollBodyPose);
+	}
+}
+
+#endif
@@ -0,0 +1,29 @@
+﻿#pragma once
+
+#include "Iris/Serialization/NetSerializer.h"
+#include "AlsRagdollBodyPoseNetSerializer.generated.h"
+
+USTRUCT()
+struct FAlsRagdollBodyPoseNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+};
+
+#if UE_WITH_IRIS
+
+namespace UE::Net
+{
+	// Iris counterpart of FAlsRagdollBodyPose::NetSerialize(). Uses the same precision, but unlike the generic
+	// struct serializer, it also delta compresses each location and rotation component against the previous state.
+
+	// This is intentionally the only ALS serializer, since Iris picks serializers per type, and the rest of the replicated
+	// ALS state is made of engine types that already have dedicated serializers with the same precision as the legacy path:
+	// - Stance, gait and overlay mode are FGameplayTag, which is sent as an index into the engine's replicated tag table.
+	// - The view rotation is FRotator, which has its own engine serializer.
+	// - The ragdoll target location is FVector_NetQuantize, which is sent as a packed vector.
+	// - FAlsMantlingParameters is built from the above types plus a weak object reference and is only sent once per
+	//   mantle, so its members are serialized by their own serializers, and a custom one would only have to redo that.
+	UE_NET_DECLARE_SERIALIZER(FAlsRagdollBodyPoseNetSerializer, ALS_API);
+}
+
+#endif
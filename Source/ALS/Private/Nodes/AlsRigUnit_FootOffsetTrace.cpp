@@ -2,6 +2,7 @@
 
 #include "Engine/HitResult.h"
 #include "Engine/World.h"
+#include "Utility/AlsStats.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsRigUnit_FootOffsetTrace)
 
@@ -21,6 +22,8 @@ FAlsRigUnit_FootOffsetTrace_Execute()
 	const FVector TraceStart{FootTargetLocation.X, FootTargetLocation.Y, TraceDistanceUpward};
 	const FVector TraceEnd{FootTargetLocation.X, FootTargetLocation.Y, -TraceDistanceDownward};
 
+	ALS_COUNT_SCENE_QUERY(ExecuteContext.GetOwningActor(), STAT_Als_FootIkSceneQueries, FootIk);
+
 	FHitResult Hit;
 	ExecuteContext.GetWorld()->LineTraceSingleByChannel(Hit, ExecuteContext.ToWorldSpace(TraceStart), ExecuteContext.ToWorldSpace(TraceEnd),
 	                                                    TraceChannel, {__FUNCTION__, true, ExecuteContext.GetOwningActor()});
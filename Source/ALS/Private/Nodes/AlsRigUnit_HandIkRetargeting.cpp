@@ -51,6 +51,10 @@ FAlsRigUnit_HandIkRetargeting_Execute()
 		return;
 	}
 
+	auto bRefreshMovedByAncestor{
+		CachedItemsToMove.Num() != ItemsToMove.Num() || CachedTopologyVersion != Hierarchy->GetTopologyVersion()
+	};
+
 	if (CachedItemsToMove.Num() != ItemsToMove.Num())
 	{
 		CachedItemsToMove.Reset();
@@ -59,12 +63,46 @@ FAlsRigUnit_HandIkRetargeting_Execute()
 
 	for (auto i{0}; i < ItemsToMove.Num(); i++)
 	{
-		if (CachedItemsToMove[i].UpdateCache(ItemsToMove[i], Hierarchy))
+		bRefreshMovedByAncestor |= CachedItemsToMove[i].GetKey() != ItemsToMove[i];
+		CachedItemsToMove[i].UpdateCache(ItemsToMove[i], Hierarchy);
+	}
+
+	if (bRefreshMovedByAncestor)
+	{
+		CachedTopologyVersion = Hierarchy->GetTopologyVersion();
+
+		CachedItemsMovedByAncestor.Reset();
+		CachedItemsMovedByAncestor.SetNumZeroed(ItemsToMove.Num());
+
+		for (auto i{0}; i < ItemsToMove.Num(); i++)
 		{
-			auto ItemTransform{Hierarchy->GetGlobalTransform(CachedItemsToMove[i])};
-			ItemTransform.AddToTranslation(RetargetingOffset);
+			for (auto j{0}; j < ItemsToMove.Num() && !CachedItemsMovedByAncestor[i]; j++)
+			{
+				CachedItemsMovedByAncestor[i] = i != j && CachedItemsToMove[i].IsValid() && CachedItemsToMove[j].IsValid() &&
+				                                Hierarchy->IsParentedTo(ItemsToMove[i], ItemsToMove[j]);
+			}
+		}
+	}
+
+	// All transforms are read before any of them is changed, so that changing an item doesn't
+	// cause the global transforms of its children to be recalculated by the following reads.
+
+	ItemsToMoveTransforms.SetNumUninitialized(ItemsToMove.Num(), EAllowShrinking::No);
 
-			Hierarchy->SetGlobalTransform(CachedItemsToMove[i], ItemTransform, bPropagateToChildren);
+	for (auto i{0}; i < ItemsToMove.Num(); i++)
+	{
+		if (CachedItemsToMove[i].IsValid() && (!bPropagateToChildren || !CachedItemsMovedByAncestor[i]))
+		{
+			ItemsToMoveTransforms[i] = Hierarchy->GetGlobalTransform(CachedItemsToMove[i]);
+			ItemsToMoveTransforms[i].AddToTranslation(RetargetingOffset);
+		}
+	}
+
+	for (auto i{0}; i < ItemsToMove.Num(); i++)
+	{
+		if (CachedItemsToMove[i].IsValid() && (!bPropagateToChildren || !CachedItemsMovedByAncestor[i]))
+		{
+			Hierarchy->SetGlobalTransform(CachedItemsToMove[i], ItemsToMoveTransforms[i], bPropagateToChildren);
 		}
 	}
 }
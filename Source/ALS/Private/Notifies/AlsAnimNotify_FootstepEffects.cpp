@@ -16,6 +16,7 @@
 #include "Utility/AlsEnumUtility.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsMath.h"
+#include "Utility/AlsStats.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimNotify_FootstepEffects)
 
@@ -108,6 +109,8 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	FCollisionQueryParams QueryParameters{__FUNCTION__, true, Mesh->GetOwner()};
 	QueryParameters.bReturnPhysicalMaterial = true;
 
+	ALS_COUNT_SCENE_QUERY(Mesh->GetOwner(), STAT_Als_FootstepSceneQueries, Footsteps);
+
 	FHitResult FootstepHit;
 	if (!World->LineTraceSingleByChannel(FootstepHit, FootTransform.GetLocation(),
 	                                     FootTransform.GetLocation() - FootZAxis *
@@ -116,6 +119,8 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	{
 		// As a fallback, trace down the world Z axis if the first trace didn't hit anything.
 
+		ALS_COUNT_SCENE_QUERY(Mesh->GetOwner(), STAT_Als_FootstepSceneQueries, Footsteps);
+
 		World->LineTraceSingleByChannel(FootstepHit, FootTransform.GetLocation(),
 		                                FootTransform.GetLocation() - FVector{
 			                                0.0f, 0.0f, FootstepEffectsSettings->SurfaceTraceDistance * MeshScale
@@ -1,5 +1,7 @@
 ﻿#include "Settings/AlsCharacterSettings.h"
 
+#include "Utility/AlsConstants.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCharacterSettings)
 
 UAlsCharacterSettings::UAlsCharacterSettings()
@@ -14,6 +16,21 @@ UAlsCharacterSettings::UAlsCharacterSettings()
 	Mantling.MantlingTraceResponses.WorldStatic = ECR_Block;
 	Mantling.MantlingTraceResponses.WorldDynamic = ECR_Block;
 	Mantling.MantlingTraceResponses.Destructible = ECR_Block;
+
+	Ragdolling.FullPoseBodyNames =
+	{
+		UAlsConstants::PelvisBoneName(),
+		UAlsConstants::Spine03BoneName(),
+		UAlsConstants::HeadBoneName(),
+		FName{TEXTVIEW("upperarm_l")},
+		FName{TEXTVIEW("lowerarm_l")},
+		FName{TEXTVIEW("upperarm_r")},
+		FName{TEXTVIEW("lowerarm_r")},
+		FName{TEXTVIEW("thigh_l")},
+		FName{TEXTVIEW("calf_l")},
+		FName{TEXTVIEW("thigh_r")},
+		FName{TEXTVIEW("calf_r")}
+	};
 }
 
 #if WITH_EDITOR
@@ -0,0 +1,119 @@
+#include "State/AlsLocomotionState.h"
+
+#include "Utility/AlsMath.h"
+#include "Utility/AlsRotation.h"
+#include "Utility/AlsVector.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsLocomotionState)
+
+void FAlsVelocityNetworkSmoothingState::Snap(const float NewServerTime, const FVector& NewVelocity, const FVector& NewInputDirection)
+{
+	ServerTime = NewServerTime;
+	ElapsedTime = 0.0f;
+	Duration = 0.0f;
+
+	ServerVelocity = NewVelocity;
+	ServerAcceleration = FVector::ZeroVector;
+	ServerInputDirection = NewInputDirection;
+
+	VelocityOffset = FVector::ZeroVector;
+	AccelerationOffset = FVector::ZeroVector;
+	InitialInputDirection = NewInputDirection;
+
+	CurrentVelocity = NewVelocity;
+	CurrentAcceleration = FVector::ZeroVector;
+	CurrentInputDirection = NewInputDirection;
+}
+
+void FAlsVelocityNetworkSmoothingState::Correct(const float NewServerTime, const FVector& NewVelocity, const FVector& NewInputDirection,
+                                                const float MaxServerDeltaTime, const float MaxExtrapolationTime, const float MaxSpeed)
+{
+	const auto ServerDeltaTime{NewServerTime - ServerTime};
+
+	if (NewServerTime <= 0.0f || ServerDeltaTime <= UE_SMALL_NUMBER || ServerDeltaTime > MaxServerDeltaTime)
+	{
+		Snap(NewServerTime, NewVelocity, NewInputDirection);
+		return;
+	}
+
+	ServerTime = NewServerTime;
+	ElapsedTime = 0.0f;
+
+	ServerAcceleration = (NewVelocity - ServerVelocity) / ServerDeltaTime;
+	ServerVelocity = NewVelocity;
+	ServerInputDirection = NewInputDirection;
+
+	// Keep following the extrapolated server values, and blend out the offsets from them over half of the time that
+	// elapsed between the last two updates on the server. Blending over the whole time keeps the current values behind
+	// the server ones for too long, and the next update will most likely be received after about the same time.
+
+	FVector TargetVelocity;
+	FVector TargetAcceleration;
+	CalculateTargetVelocityAndAcceleration(MaxExtrapolationTime, MaxSpeed, TargetVelocity, TargetAcceleration);
+
+	VelocityOffset = CurrentVelocity - TargetVelocity;
+	AccelerationOffset = CurrentAcceleration - TargetAcceleration;
+	InitialInputDirection = CurrentInputDirection;
+
+	Duration = ServerDeltaTime * 0.5f;
+}
+
+void FAlsVelocityNetworkSmoothingState::Refresh(const float DeltaTime, const float MaxExtrapolationTime, const float MaxSpeed)
+{
+	ElapsedTime += DeltaTime;
+
+	FVector TargetVelocity;
+	FVector TargetAcceleration;
+	CalculateTargetVelocityAndAcceleration(MaxExtrapolationTime, MaxSpeed, TargetVelocity, TargetAcceleration);
+
+	const auto InterpolationAmount{Duration > UE_SMALL_NUMBER ? UAlsMath::Clamp01(ElapsedTime / Duration) : 1.0f};
+	const auto OffsetAmount{1.0f - InterpolationAmount};
+
+	CurrentVelocity = TargetVelocity + VelocityOffset * OffsetAmount;
+	CurrentAcceleration = TargetAcceleration + AccelerationOffset * OffsetAmount;
+
+	// The input direction is blended on the circle, so that it doesn't pass through zero when the input is reversed. Only
+	// blends from or to no input are linear, so that the input fades in and out instead of snapping to the new direction.
+
+	if (InitialInputDirection.IsNearlyZero() || ServerInputDirection.IsNearlyZero())
+	{
+		CurrentInputDirection = FMath::Lerp(InitialInputDirection, ServerInputDirection, InterpolationAmount);
+		return;
+	}
+
+	const auto YawAngle{
+		UAlsRotation::LerpAngle(UE_REAL_TO_FLOAT(UAlsVector::DirectionToAngleXY(InitialInputDirection)),
+		                        UE_REAL_TO_FLOAT(UAlsVector::DirectionToAngleXY(ServerInputDirection)), InterpolationAmount)
+	};
+
+	CurrentInputDirection = UAlsVector::AngleToDirectionXY(YawAngle) *
+	                        FMath::Lerp(InitialInputDirection.Size(), ServerInputDirection.Size(), InterpolationAmount);
+}
+
+void FAlsVelocityNetworkSmoothingState::CalculateTargetVelocityAndAcceleration(const float MaxExtrapolationTime, const float MaxSpeed,
+                                                                              FVector& TargetVelocity,
+                                                                              FVector& TargetAcceleration) const
+{
+	// The acceleration is only applied while the velocity is extrapolated.
+
+	TargetAcceleration = ElapsedTime < MaxExtrapolationTime ? ServerAcceleration : FVector::ZeroVector;
+	TargetVelocity = ServerVelocity + ServerAcceleration * FMath::Min(ElapsedTime, MaxExtrapolationTime);
+
+	// Don't let the extrapolation reverse the movement direction when the character
+	// is stopping, or exceed the speed the character is able to move at.
+
+	if ((TargetVelocity | ServerVelocity) <= 0.0f)
+	{
+		TargetVelocity = FVector::ZeroVector;
+		TargetAcceleration = FVector::ZeroVector;
+		return;
+	}
+
+	const auto MaxTargetSpeed{FMath::Max(UE_REAL_TO_FLOAT(ServerVelocity.Size()), MaxSpeed)};
+
+	if (TargetVelocity.SizeSquared() > FMath::Square(MaxTargetSpeed))
+	{
+		TargetVelocity = TargetVelocity.GetSafeNormal() * MaxTargetSpeed;
+		TargetAcceleration = FVector::ZeroVector;
+	}
+}
@@ -0,0 +1,244 @@
+#include "State/AlsPoseHistory.h"
+
+#include "Components/SkeletalMeshComponent.h"
+#include "Settings/AlsPoseHistorySettings.h"
+#include "Utility/AlsLog.h"
+
+namespace AlsPoseHistory
+{
+	static constexpr auto LocationPrecision{10.0f};
+
+	static int16 QuantizeUnit(const double Value)
+	{
+		return static_cast<int16>(FMath::RoundToInt(FMath::Clamp(Value, -1.0, 1.0) * MAX_int16));
+	}
+
+	static int16 QuantizeLocation(const double Value)
+	{
+		return static_cast<int16>(FMath::Clamp(FMath::RoundToInt(Value * LocationPrecision), MIN_int16 + 1, MAX_int16));
+	}
+
+	static FTransform DequantizeBone(const FAlsPoseHistoryBone& Bone)
+	{
+		return {
+			Bone.Rotation.Dequantize(),
+			{
+				Bone.Location[0] / LocationPrecision,
+				Bone.Location[1] / LocationPrecision,
+				Bone.Location[2] / LocationPrecision
+			}
+		};
+	}
+}
+
+void FAlsPoseHistoryQuat::Quantize(const FQuat& Quat)
+{
+	const auto NormalizedQuat{Quat.GetNormalized()};
+
+	X = AlsPoseHistory::QuantizeUnit(NormalizedQuat.X);
+	Y = AlsPoseHistory::QuantizeUnit(NormalizedQuat.Y);
+	Z = AlsPoseHistory::QuantizeUnit(NormalizedQuat.Z);
+	W = AlsPoseHistory::QuantizeUnit(NormalizedQuat.W);
+}
+
+FQuat FAlsPoseHistoryQuat::Dequantize() const
+{
+	return FQuat{
+		static_cast<double>(X) / MAX_int16,
+		static_cast<double>(Y) / MAX_int16,
+		static_cast<double>(Z) / MAX_int16,
+		static_cast<double>(W) / MAX_int16
+	}.GetNormalized();
+}
+
+void FAlsPoseHistory::Initialize(const USkeletalMeshComponent& Mesh, const FAlsPoseHistorySettings& Settings)
+{
+	Reset();
+
+	const auto FramesCapacity{FMath::Max(2, FMath::CeilToInt(Settings.HistoryDuration * Settings.MaxRecordingRate) + 1)};
+
+	MinRecordingInterval = 1.0 / Settings.MaxRecordingRate;
+
+	BoneIndices.Reserve(Settings.BoneNames.Num());
+	BoneNames.Reserve(Settings.BoneNames.Num());
+
+	for (const auto& BoneName : Settings.BoneNames)
+	{
+		const auto BoneIndex{Mesh.GetBoneIndex(BoneName)};
+		if (BoneIndex == INDEX_NONE)
+		{
+			UE_LOG(LogAls, Warning, TEXT("%hs: Bone %s was not found in the %s mesh and will not be recorded."),
+			       __FUNCTION__, *BoneName.ToString(), *GetNameSafe(Mesh.GetSkinnedAsset()));
+			continue;
+		}
+
+		BoneIndices.Add(BoneIndex);
+		BoneNames.Add(BoneName);
+	}
+
+	Frames.SetNum(FramesCapacity);
+	Bones.SetNum(FramesCapacity * BoneIndices.Num());
+	LatestBones.SetNum(BoneIndices.Num());
+}
+
+void FAlsPoseHistory::Reset()
+{
+	Frames.Empty();
+	Bones.Empty();
+	LatestBones.Empty();
+	BoneIndices.Empty();
+	BoneNames.Empty();
+
+	NewestFrameIndex = INDEX_NONE;
+	FramesCount = 0;
+}
+
+SIZE_T FAlsPoseHistory::GetAllocatedSize() const
+{
+	return Frames.GetAllocatedSize() + Bones.GetAllocatedSize() + LatestBones.GetAllocatedSize() +
+	       BoneIndices.GetAllocatedSize() + BoneNames.GetAllocatedSize();
+}
+
+void FAlsPoseHistory::Record(const double Time, const FTransform& CapsuleTransform, const float CapsuleHalfHeight)
+{
+	if (!IsInitialized())
+	{
+		return;
+	}
+
+	if (FramesCount > 0)
+	{
+		const auto NewestFrameTime{Frames[NewestFrameIndex].Time};
+
+		if (Time < NewestFrameTime)
+		{
+			// The time has gone back, for example, after a world time reset, so the recorded frames are no longer valid.
+
+			FramesCount = 0;
+		}
+		else if (Time - NewestFrameTime < MinRecordingInterval - UE_KINDA_SMALL_NUMBER)
+		{
+			return;
+		}
+	}
+
+	NewestFrameIndex = (NewestFrameIndex + 1) % Frames.Num();
+	FramesCount = FMath::Min(FramesCount + 1, Frames.Num());
+
+	auto& Frame{Frames[NewestFrameIndex]};
+	Frame.Time = Time;
+	Frame.CapsuleLocation = CapsuleTransform.GetLocation();
+	Frame.CapsuleRotation.Quantize(CapsuleTransform.GetRotation());
+	Frame.CapsuleHalfHeight = CapsuleHalfHeight;
+
+	if (!LatestBones.IsEmpty())
+	{
+		FMemory::Memcpy(&Bones[NewestFrameIndex * BoneIndices.Num()], LatestBones.GetData(), LatestBones.NumBytes());
+	}
+}
+
+void FAlsPoseHistory::RecordBones(const double Time, const FTransform& CapsuleTransform,
+                                  const float CapsuleHalfHeight, const USkeletalMeshComponent& Mesh)
+{
+	if (!IsInitialized() || LatestBones.IsEmpty())
+	{
+		return;
+	}
+
+	const auto& ComponentSpaceTransforms{Mesh.GetComponentSpaceTransforms()};
+	const auto MeshRelativeTransform{Mesh.GetComponentTransform().GetRelativeTransform(CapsuleTransform)};
+
+	for (auto i{0}; i < BoneIndices.Num(); i++)
+	{
+		// The mesh asset may have been changed after initialization.
+
+		const auto BoneTransform{
+			ComponentSpaceTransforms.IsValidIndex(BoneIndices[i])
+				? ComponentSpaceTransforms[BoneIndices[i]] * MeshRelativeTransform
+				: MeshRelativeTransform
+		};
+
+		const auto BoneLocation{BoneTransform.GetLocation()};
+
+		auto& Bone{LatestBones[i]};
+		Bone.Location[0] = AlsPoseHistory::QuantizeLocation(BoneLocation.X);
+		Bone.Location[1] = AlsPoseHistory::QuantizeLocation(BoneLocation.Y);
+		Bone.Location[2] = AlsPoseHistory::QuantizeLocation(BoneLocation.Z);
+		Bone.Rotation.Quantize(BoneTransform.GetRotation());
+	}
+
+	if (FramesCount > 0 && Frames[NewestFrameIndex].Time == Time)
+	{
+		auto& Frame{Frames[NewestFrameIndex]};
+		Frame.CapsuleLocation = CapsuleTransform.GetLocation();
+		Frame.CapsuleRotation.Quantize(CapsuleTransform.GetRotation());
+		Frame.CapsuleHalfHeight = CapsuleHalfHeight;
+
+		FMemory::Memcpy(&Bones[NewestFrameIndex * BoneIndices.Num()], LatestBones.GetData(), LatestBones.NumBytes());
+	}
+}
+
+bool FAlsPoseHistory::TryGetPose(const double Time, FTransform& CapsuleTransform,
+                                 float& CapsuleHalfHeight, TArray<FTransform>& BoneTransforms) const
+{
+	if (FramesCount <= 0 || Time < Frames[GetFrameIndex(0)].Time)
+	{
+		return false;
+	}
+
+	// Find the newest frame that is not newer than the requested time. Frames are sorted by time, so a binary search is used.
+
+	auto FromIndex{0};
+	auto ToIndex{FramesCount - 1};
+
+	while (FromIndex < ToIndex)
+	{
+		const auto MiddleIndex{(FromIndex + ToIndex + 1) / 2};
+
+		if (Frames[GetFrameIndex(MiddleIndex)].Time <= Time)
+		{
+			FromIndex = MiddleIndex;
+		}
+		else
+		{
+			ToIndex = MiddleIndex - 1;
+		}
+	}
+
+	const auto FromFrameIndex{GetFrameIndex(FromIndex)};
+	const auto ToFrameIndex{GetFrameIndex(FMath::Min(FromIndex + 1, FramesCount - 1))};
+
+	const auto& FromFrame{Frames[FromFrameIndex]};
+	const auto& ToFrame{Frames[ToFrameIndex]};
+
+	const auto Alpha{
+		ToFrame.Time > FromFrame.Time
+			? static_cast<float>(FMath::Clamp((Time - FromFrame.Time) / (ToFrame.Time - FromFrame.Time), 0.0, 1.0))
+			: 0.0f
+	};
+
+	CapsuleTransform.SetLocation(FMath::Lerp(FromFrame.CapsuleLocation, ToFrame.CapsuleLocation, Alpha));
+	CapsuleTransform.SetRotation(FQuat::Slerp(FromFrame.CapsuleRotation.Dequantize(), ToFrame.CapsuleRotation.Dequantize(), Alpha));
+	CapsuleTransform.SetScale3D(FVector::OneVector);
+
+	CapsuleHalfHeight = FMath::Lerp(FromFrame.CapsuleHalfHeight, ToFrame.CapsuleHalfHeight, Alpha);
+
+	BoneTransforms.SetNumUninitialized(BoneIndices.Num(), EAllowShrinking::No);
+
+	const auto* FromBones{Bones.GetData() + FromFrameIndex * BoneIndices.Num()};
+	const auto* ToBones{Bones.GetData() + ToFrameIndex * BoneIndices.Num()};
+
+	for (auto i{0}; i < BoneIndices.Num(); i++)
+	{
+		auto BoneTransform{AlsPoseHistory::DequantizeBone(FromBones[i])};
+
+		if (Alpha > 0.0f)
+		{
+			BoneTransform.BlendWith(AlsPoseHistory::DequantizeBone(ToBones[i]), Alpha);
+		}
+
+		BoneTransforms[i] = BoneTransform * CapsuleTransform;
+	}
+
+	return true;
+}
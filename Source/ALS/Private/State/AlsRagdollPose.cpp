@@ -0,0 +1,27 @@
+#include "State/AlsRagdollPose.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsRagdollPose)
+
+void FAlsRagdollBodyPose::Quantize()
+{
+	static constexpr auto LocationScale{10.0};
+
+	Location.X = FMath::RoundToDouble(Location.X * LocationScale) / LocationScale;
+	Location.Y = FMath::RoundToDouble(Location.Y * LocationScale) / LocationScale;
+	Location.Z = FMath::RoundToDouble(Location.Z * LocationScale) / LocationScale;
+
+	Rotation.Pitch = FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Rotation.Pitch));
+	Rotation.Yaw = FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Rotation.Yaw));
+	Rotation.Roll = FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Rotation.Roll));
+}
+
+bool FAlsRagdollBodyPose::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	// Locations are relative to the root body, so 24 bits with 0.1 cm precision are more than enough here.
+
+	bSuccess = SerializePackedVector<10, 24>(Location, Archive);
+
+	Rotation.SerializeCompressedShort(Archive);
+
+	return true;
+}
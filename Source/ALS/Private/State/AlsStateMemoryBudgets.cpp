@@ -0,0 +1,84 @@
+#include "HAL/IConsoleManager.h"
+#include "State/AlsFeetState.h"
+#include "State/AlsHeadState.h"
+#include "State/AlsInAirState.h"
+#include "State/AlsLocomotionAnimationState.h"
+#include "State/AlsLocomotionState.h"
+#include "State/AlsLookState.h"
+#include "State/AlsMovementBaseState.h"
+#include "State/AlsPoseHistory.h"
+#include "State/AlsRagdollingState.h"
+#include "State/AlsSpineState.h"
+#include "State/AlsStandingState.h"
+#include "State/AlsTransitionsState.h"
+#include "State/AlsTurnInPlaceState.h"
+#include "State/AlsViewAnimationState.h"
+#include "State/AlsViewState.h"
+#include "Utility/AlsLog.h"
+
+// These states are stored per character or per animation instance and most of them are read or written every frame,
+// so their sizes are kept under fixed budgets. If one of the assertions below fails, first try to reorder the struct
+// members to get rid of the padding (for example, keep bit fields together), and only then raise the budget.
+
+#define ALS_STATE_MEMORY_BUDGET(Type, Budget) \
+	static_assert(sizeof(Type) <= (Budget), #Type " exceeds its memory budget of " #Budget " bytes.")
+
+ALS_STATE_MEMORY_BUDGET(FAlsLocomotionState, 64);
+ALS_STATE_MEMORY_BUDGET(FAlsLocomotionAnimationState, 176);
+ALS_STATE_MEMORY_BUDGET(FAlsViewState, 120);
+ALS_STATE_MEMORY_BUDGET(FAlsViewAnimationState, 48);
+ALS_STATE_MEMORY_BUDGET(FAlsMovementBaseState, 112);
+ALS_STATE_MEMORY_BUDGET(FAlsTransitionsState, 32);
+ALS_STATE_MEMORY_BUDGET(FAlsTurnInPlaceState, 32);
+ALS_STATE_MEMORY_BUDGET(FAlsRagdollingState, 96);
+ALS_STATE_MEMORY_BUDGET(FAlsInAirState, 16);
+ALS_STATE_MEMORY_BUDGET(FAlsSpineState, 32);
+ALS_STATE_MEMORY_BUDGET(FAlsLookState, 28);
+ALS_STATE_MEMORY_BUDGET(FAlsHeadState, 20);
+ALS_STATE_MEMORY_BUDGET(FAlsStandingState, 28);
+ALS_STATE_MEMORY_BUDGET(FAlsFootState, 192);
+ALS_STATE_MEMORY_BUDGET(FAlsFeetState, 416);
+
+// Pose history frames are stored for every recorded server frame, with 60 frames per second over one second of
+// history and 20 bones, 100 characters take 61 * (48 + 20 * 14) * 100 bytes, which is about 2 MB.
+
+ALS_STATE_MEMORY_BUDGET(FAlsPoseHistoryFrame, 48);
+ALS_STATE_MEMORY_BUDGET(FAlsPoseHistoryBone, 14);
+
+#undef ALS_STATE_MEMORY_BUDGET
+
+namespace AlsStateMemoryBudgets
+{
+	static void ReportSizes()
+	{
+#define ALS_REPORT_STATE_SIZE(Type) \
+		UE_LOG(LogAls, Log, TEXT("%s: %d bytes, %d bytes alignment."), TEXT(#Type), \
+		       static_cast<int32>(sizeof(Type)), static_cast<int32>(alignof(Type)))
+
+		ALS_REPORT_STATE_SIZE(FAlsLocomotionState);
+		ALS_REPORT_STATE_SIZE(FAlsLocomotionAnimationState);
+		ALS_REPORT_STATE_SIZE(FAlsViewState);
+		ALS_REPORT_STATE_SIZE(FAlsViewAnimationState);
+		ALS_REPORT_STATE_SIZE(FAlsMovementBaseState);
+		ALS_REPORT_STATE_SIZE(FAlsTransitionsState);
+		ALS_REPORT_STATE_SIZE(FAlsTurnInPlaceState);
+		ALS_REPORT_STATE_SIZE(FAlsRagdollingState);
+		ALS_REPORT_STATE_SIZE(FAlsInAirState);
+		ALS_REPORT_STATE_SIZE(FAlsSpineState);
+		ALS_REPORT_STATE_SIZE(FAlsLookState);
+		ALS_REPORT_STATE_SIZE(FAlsHeadState);
+		ALS_REPORT_STATE_SIZE(FAlsStandingState);
+		ALS_REPORT_STATE_SIZE(FAlsFootState);
+		ALS_REPORT_STATE_SIZE(FAlsFeetState);
+		ALS_REPORT_STATE_SIZE(FAlsPoseHistoryFrame);
+		ALS_REPORT_STATE_SIZE(FAlsPoseHistoryBone);
+
+#undef ALS_REPORT_STATE_SIZE
+	}
+
+	static FAutoConsoleCommand ConsoleCommandReportSizes{
+		TEXT("als.State.ReportSizes"),
+		TEXT("Logs the sizes of the ALS per character and per animation instance states."),
+		FConsoleCommandDelegate::CreateStatic(&ReportSizes)
+	};
+}
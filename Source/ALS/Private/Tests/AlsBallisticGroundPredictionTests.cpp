@@ -0,0 +1,52 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "State/AlsInAirState.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsBallisticGroundPredictionTrajectoryTest, "Als.Animation.BallisticGroundPrediction.Trajectory",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsBallisticGroundPredictionTrajectoryTest::RunTest(const FString& Parameters)
+{
+	FAlsBallisticGroundPredictionState Prediction;
+	Prediction.StartLocation = {100.0, 200.0, 300.0};
+	Prediction.StartVelocity = {500.0, -250.0, 1000.0};
+	Prediction.GravityZ = -1000.0f;
+	Prediction.MinVerticalVelocity = -4000.0f;
+
+	// The vertical velocity reaches -4000 after 5 seconds.
+
+	TestEqual(TEXT("Minimum vertical velocity time"), Prediction.GetMinVerticalVelocityTime(), 5.0, UE_KINDA_SMALL_NUMBER);
+
+	// Before that, the trajectory is a parabola.
+
+	TestEqual(TEXT("Location before reaching the minimum vertical velocity"), Prediction.GetLocation(2.0),
+	          FVector{1100.0, -300.0, 300.0 + 2000.0 - 2000.0}, UE_KINDA_SMALL_NUMBER);
+
+	TestEqual(TEXT("Velocity before reaching the minimum vertical velocity"), Prediction.GetVelocity(2.0),
+	          FVector{500.0, -250.0, -1000.0}, UE_KINDA_SMALL_NUMBER);
+
+	// After that, the character keeps falling at the minimum vertical velocity.
+
+	const auto LocationAtMinVerticalVelocity{Prediction.GetLocation(5.0)};
+
+	TestEqual(TEXT("Location when reaching the minimum vertical velocity"), LocationAtMinVerticalVelocity,
+	          FVector{2600.0, -1050.0, 300.0 + 5000.0 - 12500.0}, UE_KINDA_SMALL_NUMBER);
+
+	TestEqual(TEXT("Location after reaching the minimum vertical velocity"), Prediction.GetLocation(7.0),
+	          LocationAtMinVerticalVelocity + FVector{1000.0, -500.0, -8000.0}, UE_KINDA_SMALL_NUMBER);
+
+	TestEqual(TEXT("Velocity after reaching the minimum vertical velocity"), Prediction.GetVelocity(7.0),
+	          FVector{500.0, -250.0, -4000.0}, UE_KINDA_SMALL_NUMBER);
+
+	// Without gravity, the vertical velocity never changes.
+
+	Prediction.GravityZ = 0.0f;
+
+	TestEqual(TEXT("Velocity without gravity"), Prediction.GetVelocity(10.0), Prediction.StartVelocity, UE_KINDA_SMALL_NUMBER);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,456 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AlsAnimationInstance.h"
+#include "AlsCharacter.h"
+#include "AlsCharacterMovementComponent.h"
+#include "AlsCharacterPoolSubsystem.h"
+#include "Components/BoxComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsPrivateMemberAccessor.h"
+
+ALS_DEFINE_PRIVATE_MEMBER_ACCESSOR(AlsCharacterPoolMantlingStateAccessor, &AAlsCharacter::MantlingState,
+                                   FAlsMantlingState AAlsCharacter::*)
+
+ALS_DEFINE_PRIVATE_MEMBER_ACCESSOR(AlsCharacterPoolFeetStateAccessor, &UAlsAnimationInstance::FeetState,
+                                   FAlsFeetState UAlsAnimationInstance::*)
+
+namespace AlsCharacterPoolTests
+{
+	static const auto* CharacterClassPath{TEXT("/ALS/ALSManny/Characters/B_AlsManny_Character.B_AlsManny_Character_C")};
+
+	static constexpr auto DeltaTime{1.0f / 30.0f};
+
+	// Everything that must be the same for a reused character and a freshly spawned one.
+
+	struct FCharacterSnapshot
+	{
+		bool bHidden{false};
+
+		bool bCollisionEnabled{false};
+
+		bool bActorTickEnabled{false};
+
+		TMap<FName, bool> ComponentTicksEnabled;
+
+		TEnumAsByte<EMovementMode> MovementMode{MOVE_None};
+
+		uint8 CustomMovementMode{0};
+
+		FVector Velocity{ForceInit};
+
+		FGameplayTag ViewMode;
+
+		FGameplayTag LocomotionMode;
+
+		FGameplayTag DesiredRotationMode;
+
+		FGameplayTag RotationMode;
+
+		FGameplayTag DesiredStance;
+
+		FGameplayTag Stance;
+
+		FGameplayTag DesiredGait;
+
+		FGameplayTag Gait;
+
+		FGameplayTag OverlayMode;
+
+		FGameplayTag LocomotionAction;
+
+		bool bDesiredAiming{false};
+
+		bool bHasInput{false};
+
+		bool bMoving{false};
+
+		float Speed{0.0f};
+
+		explicit FCharacterSnapshot(const AAlsCharacter& Character)
+		{
+			bHidden = Character.IsHidden();
+			bCollisionEnabled = Character.GetActorEnableCollision();
+			bActorTickEnabled = Character.IsActorTickEnabled();
+
+			for (const auto* Component : Character.GetComponents())
+			{
+				if (IsValid(Component))
+				{
+					ComponentTicksEnabled.Add(Component->GetFName(), Component->IsComponentTickEnabled());
+				}
+			}
+
+			MovementMode = Character.GetCharacterMovement()->MovementMode;
+			CustomMovementMode = Character.GetCharacterMovement()->CustomMovementMode;
+			Velocity = Character.GetVelocity();
+
+			ViewMode = Character.GetViewMode();
+			LocomotionMode = Character.GetLocomotionMode();
+			DesiredRotationMode = Character.GetDesiredRotationMode();
+			RotationMode = Character.GetRotationMode();
+			DesiredStance = Character.GetDesiredStance();
+			Stance = Character.GetStance();
+			DesiredGait = Character.GetDesiredGait();
+			Gait = Character.GetGait();
+			OverlayMode = Character.GetOverlayMode();
+			LocomotionAction = Character.GetLocomotionAction();
+			bDesiredAiming = Character.IsDesiredAiming();
+
+			const auto& LocomotionState{Character.GetLocomotionState()};
+
+			bHasInput = LocomotionState.bHasInput;
+			bMoving = LocomotionState.bMoving;
+			Speed = LocomotionState.Speed;
+		}
+	};
+
+	static void TestSnapshotsEqual(FAutomationTestBase& Test, const FString& Context,
+	                               const FCharacterSnapshot& Actual, const FCharacterSnapshot& Expected)
+	{
+		Test.TestEqual(Context + TEXT(": hidden"), Actual.bHidden, Expected.bHidden);
+		Test.TestEqual(Context + TEXT(": collision enabled"), Actual.bCollisionEnabled, Expected.bCollisionEnabled);
+		Test.TestEqual(Context + TEXT(": actor tick enabled"), Actual.bActorTickEnabled, Expected.bActorTickEnabled);
+
+		for (const auto& [ComponentName, bTickEnabled] : Expected.ComponentTicksEnabled)
+		{
+			const auto* bActualTickEnabled{Actual.ComponentTicksEnabled.Find(ComponentName)};
+
+			if (Test.TestNotNull(FString::Printf(TEXT("%s: %s component exists"), *Context, *ComponentName.ToString()),
+			                     bActualTickEnabled))
+			{
+				Test.TestEqual(FString::Printf(TEXT("%s: %s component tick enabled"), *Context, *ComponentName.ToString()),
+				               *bActualTickEnabled, bTickEnabled);
+			}
+		}
+
+		Test.TestEqual(Context + TEXT(": movement mode"),
+		               static_cast<int32>(Actual.MovementMode), static_cast<int32>(Expected.MovementMode));
+		Test.TestEqual(Context + TEXT(": custom movement mode"),
+		               static_cast<int32>(Actual.CustomMovementMode), static_cast<int32>(Expected.CustomMovementMode));
+		Test.TestEqual(Context + TEXT(": velocity"), Actual.Velocity, Expected.Velocity, UE_KINDA_SMALL_NUMBER);
+
+		Test.TestEqual(Context + TEXT(": view mode"), Actual.ViewMode.ToString(), Expected.ViewMode.ToString());
+		Test.TestEqual(Context + TEXT(": locomotion mode"), Actual.LocomotionMode.ToString(), Expected.LocomotionMode.ToString());
+		Test.TestEqual(Context + TEXT(": desired rotation mode"),
+		               Actual.DesiredRotationMode.ToString(), Expected.DesiredRotationMode.ToString());
+		Test.TestEqual(Context + TEXT(": rotation mode"), Actual.RotationMode.ToString(), Expected.RotationMode.ToString());
+		Test.TestEqual(Context + TEXT(": desired stance"), Actual.DesiredStance.ToString(), Expected.DesiredStance.ToString());
+		Test.TestEqual(Context + TEXT(": stance"), Actual.Stance.ToString(), Expected.Stance.ToString());
+		Test.TestEqual(Context + TEXT(": desired gait"), Actual.DesiredGait.ToString(), Expected.DesiredGait.ToString());
+		Test.TestEqual(Context + TEXT(": gait"), Actual.Gait.ToString(), Expected.Gait.ToString());
+		Test.TestEqual(Context + TEXT(": overlay mode"), Actual.OverlayMode.ToString(), Expected.OverlayMode.ToString());
+		Test.TestEqual(Context + TEXT(": locomotion action"), Actual.LocomotionAction.ToString(), Expected.LocomotionAction.ToString());
+		Test.TestEqual(Context + TEXT(": desired aiming"), Actual.bDesiredAiming, Expected.bDesiredAiming);
+
+		Test.TestEqual(Context + TEXT(": has input"), Actual.bHasInput, Expected.bHasInput);
+		Test.TestEqual(Context + TEXT(": moving"), Actual.bMoving, Expected.bMoving);
+		Test.TestEqual(Context + TEXT(": speed"), Actual.Speed, Expected.Speed, UE_KINDA_SMALL_NUMBER);
+	}
+
+	// States left behind by locomotion actions, which are only compared right after the character is taken
+	// from the pool, since some of them, such as the foot lock locations, depend on the character's location.
+
+	static void TestActionStatesEqual(FAutomationTestBase& Test, const FString& Context,
+	                                  const AAlsCharacter& Actual, const AAlsCharacter& Expected)
+	{
+		Test.TestEqual(Context + TEXT(": proned"), Actual.IsProned(), Expected.IsProned());
+
+		Test.TestTrue(Context + TEXT(": mantling state"), FAlsMantlingState::StaticStruct()->CompareScriptStruct(
+			              &AlsCharacterPoolMantlingStateAccessor::Access(Actual),
+			              &AlsCharacterPoolMantlingStateAccessor::Access(Expected), PPF_None));
+
+		Test.TestTrue(Context + TEXT(": ragdolling state"), FAlsRagdollingState::StaticStruct()->CompareScriptStruct(
+			              &Actual.GetRagdollingState(), &Expected.GetRagdollingState(), PPF_None));
+
+		const auto* ActualAnimationInstance{Cast<UAlsAnimationInstance>(Actual.GetMesh()->GetAnimInstance())};
+		const auto* ExpectedAnimationInstance{Cast<UAlsAnimationInstance>(Expected.GetMesh()->GetAnimInstance())};
+
+		if (Test.TestNotNull(Context + TEXT(": animation instance exists"), ActualAnimationInstance) &&
+		    Test.TestNotNull(Context + TEXT(": fresh animation instance exists"), ExpectedAnimationInstance))
+		{
+			Test.TestTrue(Context + TEXT(": feet state"), FAlsFeetState::StaticStruct()->CompareScriptStruct(
+				              &AlsCharacterPoolFeetStateAccessor::Access(*ActualAnimationInstance),
+				              &AlsCharacterPoolFeetStateAccessor::Access(*ExpectedAnimationInstance), PPF_None));
+		}
+	}
+
+	static void SpawnBox(UWorld& World, const FVector& Location, const FVector& Extent)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.ObjectFlags |= RF_Transient;
+
+		auto* BoxActor{World.SpawnActor<AActor>(Location, FRotator::ZeroRotator, SpawnParameters)};
+
+		auto* Box{NewObject<UBoxComponent>(BoxActor)};
+		Box->SetBoxExtent(Extent);
+		Box->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		BoxActor->SetRootComponent(Box);
+		Box->RegisterComponent();
+	}
+
+	struct FLocomotionAction
+	{
+		const TCHAR* Name{nullptr};
+
+		// Starts the action and returns whether it was started.
+		TFunction<bool(AAlsCharacter& Character)> Start;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsCharacterPoolReuseTest, "Als.Character.Pool.Reuse",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsCharacterPoolReuseTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsCharacterPoolTests;
+
+	const TSubclassOf<AAlsCharacter> CharacterClass{LoadClass<AAlsCharacter>(nullptr, CharacterClassPath)};
+	if (!TestNotNull(TEXT("Character class is loaded"), CharacterClass.Get()))
+	{
+		return false;
+	}
+
+	auto* World{UWorld::CreateWorld(EWorldType::Game, false)};
+	GEngine->CreateNewWorldContext(EWorldType::Game).SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL{});
+	World->GetWorldSettings()->NotifyBeginPlay();
+
+	auto* Pool{World->GetSubsystem<UAlsCharacterPoolSubsystem>()};
+
+	if (TestNotNull(TEXT("Character pool exists"), Pool))
+	{
+		const FTransform ReusedTransform{FVector{0.0, 0.0, 100.0}};
+		const FTransform FreshTransform{FVector{1000.0, 0.0, 100.0}};
+
+		// Characters put into the pool right after spawning must come out of it the same as freshly spawned ones.
+
+		Pool->Prewarm(CharacterClass, 1);
+
+		auto* PrewarmedCharacter{Pool->AcquireCharacter(CharacterClass, ReusedTransform)};
+		auto* FreshCharacter{Pool->AcquireCharacter(CharacterClass, FreshTransform)};
+
+		if (TestNotNull(TEXT("Prewarmed character is acquired"), PrewarmedCharacter) &&
+		    TestNotNull(TEXT("Fresh character is spawned"), FreshCharacter))
+		{
+			TestSnapshotsEqual(*this, TEXT("Prewarmed"), FCharacterSnapshot{*PrewarmedCharacter}, FCharacterSnapshot{*FreshCharacter});
+
+			// Change the character's state, then put it back into the pool and take it out again.
+
+			PrewarmedCharacter->SetDesiredStance(AlsStanceTags::Crouching);
+			PrewarmedCharacter->SetDesiredGait(AlsGaitTags::Sprinting);
+			PrewarmedCharacter->SetDesiredAiming(true);
+			PrewarmedCharacter->SetOverlayMode(AlsOverlayModeTags::Injured);
+			PrewarmedCharacter->GetCharacterMovement()->Velocity = {300.0, 0.0, 0.0};
+
+			World->Tick(LEVELTICK_All, DeltaTime);
+
+			Pool->ReleaseCharacter(PrewarmedCharacter);
+
+			TestEqual(TEXT("Released character is pooled"), Pool->GetPooledCharactersCount(CharacterClass), 1);
+
+			auto* ReusedCharacter{Pool->AcquireCharacter(CharacterClass, ReusedTransform)};
+			auto* OtherFreshCharacter{Pool->AcquireCharacter(CharacterClass, FTransform{FVector{1000.0, 1000.0, 100.0}})};
+
+			TestTrue(TEXT("Released character is reused"), ReusedCharacter == PrewarmedCharacter);
+
+			if (TestNotNull(TEXT("Other fresh character is spawned"), OtherFreshCharacter))
+			{
+				TestSnapshotsEqual(*this, TEXT("Reused"), FCharacterSnapshot{*ReusedCharacter},
+				                   FCharacterSnapshot{*OtherFreshCharacter});
+
+				// The reused state must also evolve the same way.
+
+				World->Tick(LEVELTICK_All, DeltaTime);
+
+				TestSnapshotsEqual(*this, TEXT("Reused after tick"), FCharacterSnapshot{*ReusedCharacter},
+				                   FCharacterSnapshot{*OtherFreshCharacter});
+			}
+		}
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsCharacterPoolReuseAfterActionsTest, "Als.Character.Pool.ReuseAfterActions",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsCharacterPoolReuseAfterActionsTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsCharacterPoolTests;
+
+	const TSubclassOf<AAlsCharacter> CharacterClass{LoadClass<AAlsCharacter>(nullptr, CharacterClassPath)};
+	if (!TestNotNull(TEXT("Character class is loaded"), CharacterClass.Get()))
+	{
+		return false;
+	}
+
+	auto* World{UWorld::CreateWorld(EWorldType::Game, false)};
+	GEngine->CreateNewWorldContext(EWorldType::Game).SetCurrentWorld(World);
+
+	SpawnBox(*World, FVector::ZeroVector, {5000.0, 5000.0, 10.0});
+
+	World->InitializeActorsForPlay(FURL{});
+	World->GetWorldSettings()->NotifyBeginPlay();
+
+	auto* Pool{World->GetSubsystem<UAlsCharacterPoolSubsystem>()};
+
+	if (TestNotNull(TEXT("Character pool exists"), Pool))
+	{
+		const FLocomotionAction Actions[]{
+			{
+				TEXT("Ragdolling"), [](AAlsCharacter& Character)
+				{
+					Character.StartRagdolling();
+					return Character.GetLocomotionAction() == AlsLocomotionActionTags::Ragdolling;
+				}
+			},
+			{
+				TEXT("Mantling"), [World](AAlsCharacter& Character)
+				{
+					SpawnBox(*World, Character.GetActorLocation() + FVector{130.0, 0.0, -50.0}, {50.0, 200.0, 50.0});
+
+					if (!Character.StartMantlingGrounded())
+					{
+						return false;
+					}
+
+					// Let the mantling root motion source be applied before the character is put into the pool.
+
+					for (auto i{0}; i < 5; i++)
+					{
+						World->Tick(LEVELTICK_All, DeltaTime);
+					}
+
+					return Character.GetLocomotionAction() == AlsLocomotionActionTags::Mantling;
+				}
+			},
+			{
+				TEXT("Proning"), [](AAlsCharacter& Character)
+				{
+					Cast<UAlsCharacterMovementComponent>(Character.GetCharacterMovement())->Prone();
+					return Character.IsProned();
+				}
+			},
+			{
+				TEXT("Sliding"), [](AAlsCharacter& Character)
+				{
+					auto* Movement{Cast<UAlsCharacterMovementComponent>(Character.GetCharacterMovement())};
+
+					Character.Crouch();
+					Movement->SetMovementMode(MOVE_Custom, CMOVE_Slide);
+
+					return Movement->IsCustomMovementMode(CMOVE_Slide);
+				}
+			}
+		};
+
+		auto ActionIndex{0};
+
+		for (const auto& Action : Actions)
+		{
+			// Each action gets its own place, so that the obstacles of one action don't affect the others.
+
+			const FTransform ReusedTransform{FVector{0.0, ActionIndex * 1000.0, 110.0}};
+			const FTransform FreshTransform{FVector{2000.0, ActionIndex * 1000.0, 110.0}};
+
+			ActionIndex += 1;
+
+			auto* Character{Pool->AcquireCharacter(CharacterClass, ReusedTransform)};
+			if (!TestNotNull(FString::Printf(TEXT("%s: character is spawned"), Action.Name), Character))
+			{
+				continue;
+			}
+
+			// Let the character land before starting the action.
+
+			for (auto i{0}; i < 10; i++)
+			{
+				World->Tick(LEVELTICK_All, DeltaTime);
+			}
+
+			if (TestTrue(FString::Printf(TEXT("%s: action is started"), Action.Name), Action.Start(*Character)))
+			{
+				Pool->ReleaseCharacter(Character);
+
+				auto* ReusedCharacter{Pool->AcquireCharacter(CharacterClass, ReusedTransform)};
+				auto* FreshCharacter{Pool->AcquireCharacter(CharacterClass, FreshTransform)};
+
+				TestTrue(FString::Printf(TEXT("%s: released character is reused"), Action.Name), ReusedCharacter == Character);
+
+				if (TestNotNull(FString::Printf(TEXT("%s: fresh character is spawned"), Action.Name), FreshCharacter))
+				{
+					TestSnapshotsEqual(*this, Action.Name, FCharacterSnapshot{*ReusedCharacter}, FCharacterSnapshot{*FreshCharacter});
+					TestActionStatesEqual(*this, Action.Name, *ReusedCharacter, *FreshCharacter);
+
+					FreshCharacter->Destroy();
+				}
+			}
+
+			Character->Destroy();
+		}
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsCharacterPoolTickStatesTest, "Als.Character.Pool.TickStates",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsCharacterPoolTickStatesTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsCharacterPoolTests;
+
+	const TSubclassOf<AAlsCharacter> CharacterClass{LoadClass<AAlsCharacter>(nullptr, CharacterClassPath)};
+	if (!TestNotNull(TEXT("Character class is loaded"), CharacterClass.Get()))
+	{
+		return false;
+	}
+
+	auto* World{UWorld::CreateWorld(EWorldType::Game, false)};
+	GEngine->CreateNewWorldContext(EWorldType::Game).SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL{});
+	World->GetWorldSettings()->NotifyBeginPlay();
+
+	auto* Pool{World->GetSubsystem<UAlsCharacterPoolSubsystem>()};
+	auto* Character{IsValid(Pool) ? Pool->AcquireCharacter(CharacterClass, FTransform{FVector{0.0, 0.0, 100.0}}) : nullptr};
+
+	if (TestNotNull(TEXT("Character is spawned"), Character))
+	{
+		// Tick states changed at runtime must survive the pool, rather than be reset to the ones the components start with.
+
+		auto* Mesh{Character->GetMesh()};
+		const auto bMeshStartsWithTickEnabled{static_cast<bool>(Mesh->PrimaryComponentTick.bStartWithTickEnabled)};
+
+		Mesh->SetComponentTickEnabled(!bMeshStartsWithTickEnabled);
+
+		Pool->ReleaseCharacter(Character);
+
+		TestFalse(TEXT("Pooled mesh doesn't tick"), Mesh->IsComponentTickEnabled());
+
+		Pool->AcquireCharacter(CharacterClass, FTransform{FVector{0.0, 0.0, 100.0}});
+
+		TestEqual(TEXT("Runtime mesh tick state is restored"), Mesh->IsComponentTickEnabled(), !bMeshStartsWithTickEnabled);
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,117 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Utility/AlsSkeletalMeshData.h"
+#include "Utility/AlsUtility.h"
+
+namespace AlsFeetTargetsTests
+{
+	static const auto* SkeletalMeshPath{TEXT("/ALS/ALSManny/Characters/Mannequins/Meshes/SK_Mannequin.SK_Mannequin")};
+
+	static USkeletalMeshComponent* CreateMesh(AActor& Actor, USkeletalMesh& SkeletalMesh, USkeletalMeshComponent* LeaderMesh)
+	{
+		auto* Mesh{NewObject<USkeletalMeshComponent>(&Actor)};
+		Mesh->SetSkeletalMeshAsset(&SkeletalMesh);
+		Mesh->SetupAttachment(Actor.GetRootComponent());
+		Mesh->RegisterComponent();
+
+		if (IsValid(LeaderMesh))
+		{
+			Mesh->SetLeaderPoseComponent(LeaderMesh);
+		}
+
+		return Mesh;
+	}
+
+	// Compares the transforms used by the foot lock against the socket transforms that were used before.
+
+	static void TestBone(FAutomationTestBase& Test, const USkeletalMeshComponent& Mesh, const int32 BoneIndex, const TCHAR* Description)
+	{
+		if (BoneIndex < 0)
+		{
+			return;
+		}
+
+		const auto BoneName{Mesh.GetSkinnedAsset()->GetRefSkeleton().GetBoneName(BoneIndex)};
+		const auto ExpectedTransform{Mesh.GetSocketTransform(BoneName, RTS_Component)};
+
+		FTransform Transform;
+
+		if (Test.TestTrue(FString::Printf(TEXT("%s: %s transform is available"), Description, *BoneName.ToString()),
+		                  UAlsUtility::TryGetComponentSpaceBoneTransform(Mesh, BoneIndex, Transform)))
+		{
+			Test.TestTrue(FString::Printf(TEXT("%s: %s transform matches the socket transform"), Description, *BoneName.ToString()),
+			              Transform.Equals(ExpectedTransform, UE_KINDA_SMALL_NUMBER));
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsFeetTargetsEquivalenceTest, "Als.Animation.FeetTargets.Equivalence",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsFeetTargetsEquivalenceTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsFeetTargetsTests;
+
+	auto* SkeletalMesh{LoadObject<USkeletalMesh>(nullptr, SkeletalMeshPath)};
+	if (!TestNotNull(TEXT("Skeletal mesh is loaded"), SkeletalMesh))
+	{
+		return false;
+	}
+
+	auto* World{UWorld::CreateWorld(EWorldType::Game, false)};
+	auto& WorldContext{GEngine->CreateNewWorldContext(EWorldType::Game)};
+	WorldContext.SetCurrentWorld(World);
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+
+	auto* Actor{World->SpawnActor<AActor>(FVector{100.0, 200.0, 300.0}, FRotator{0.0, 45.0, 0.0}, SpawnParameters)};
+	Actor->SetRootComponent(NewObject<USceneComponent>(Actor));
+	Actor->GetRootComponent()->RegisterComponent();
+
+	auto* LeaderMesh{CreateMesh(*Actor, *SkeletalMesh, nullptr)};
+	auto* FollowerMesh{CreateMesh(*Actor, *SkeletalMesh, LeaderMesh)};
+
+	// Rotate the leader mesh so that the component space differs from the world space.
+
+	LeaderMesh->SetRelativeRotation(FRotator{0.0, -90.0, 0.0});
+	LeaderMesh->RefreshBoneTransforms();
+	LeaderMesh->FinalizeBoneTransform();
+
+	const auto SkeletalMeshData{FAlsSkeletalMeshData::Get(*SkeletalMesh)};
+
+	TestTrue(TEXT("Foot ik bones are found"), SkeletalMeshData->HasFootIkBones());
+	TestTrue(TEXT("Foot virtual bones are found"), SkeletalMeshData->HasFootVirtualBones());
+
+	for (const auto* Mesh : {LeaderMesh, FollowerMesh})
+	{
+		const auto* Description{Mesh == LeaderMesh ? TEXT("Leader") : TEXT("Follower")};
+
+		TestBone(*this, *Mesh, SkeletalMeshData->PelvisBoneIndex, Description);
+		TestBone(*this, *Mesh, SkeletalMeshData->FootLeftIkBoneIndex, Description);
+		TestBone(*this, *Mesh, SkeletalMeshData->FootRightIkBoneIndex, Description);
+		TestBone(*this, *Mesh, SkeletalMeshData->FootLeftVirtualBoneIndex, Description);
+		TestBone(*this, *Mesh, SkeletalMeshData->FootRightVirtualBoneIndex, Description);
+	}
+
+	// The follower must not fall back to the identity transform, which would break the foot lock.
+
+	FTransform FollowerPelvisTransform;
+	UAlsUtility::TryGetComponentSpaceBoneTransform(*FollowerMesh, SkeletalMeshData->PelvisBoneIndex, FollowerPelvisTransform);
+
+	TestFalse(TEXT("Follower pelvis transform is not identity"), FollowerPelvisTransform.Equals(FTransform::Identity));
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif
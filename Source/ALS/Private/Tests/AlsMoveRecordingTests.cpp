@@ -0,0 +1,201 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AlsCharacter.h"
+#include "AlsCharacterMovementComponent.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/Engine.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsMoveRecording.h"
+#include "Utility/AlsPrivateMemberAccessor.h"
+
+// Moves are recorded from MoveAutonomous(), which is only called by the engine when a client move is received.
+
+ALS_DEFINE_PRIVATE_MEMBER_ACCESSOR(AlsMoveAutonomousAccessor, &UAlsCharacterMovementComponent::MoveAutonomous,
+                                   void (UAlsCharacterMovementComponent::*)(float, float, uint8, const FVector&))
+
+namespace AlsMoveRecordingTests
+{
+	static const auto* CharacterClassPath{TEXT("/ALS/ALSManny/Characters/B_AlsManny_Character.B_AlsManny_Character_C")};
+
+	static constexpr auto DeltaTime{1.0f / 60.0f};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMoveRecordingRoundTripTest, "Als.Movement.MoveRecording.RoundTrip",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMoveRecordingRoundTripTest::RunTest(const FString& Parameters)
+{
+	FAlsRecordedMove Move;
+	Move.TimeStamp = 12.5f;
+	Move.DeltaTime = 1.0f / 60.0f;
+	Move.CompressedFlags = 0b10001;
+	Move.StartMovementMode = MOVE_Custom;
+	Move.StartCustomMovementMode = 1;
+	Move.Acceleration = {100.0, -200.0, 0.0};
+	Move.StartLocation = {1.0, 2.0, 3.0};
+	Move.StartRotation = {0.0, 90.0, 0.0};
+	Move.StartVelocity = {400.0, 0.0, 0.0};
+	Move.StartCapsuleHalfHeight = 60.0f;
+	Move.bStartCrouched = true;
+	Move.bStartProned = false;
+	Move.bStartWantsToCrouch = true;
+	Move.bStartWantsToProne = false;
+	Move.bStartPrevWantsToCrouch = true;
+	Move.EndLocation = {8.0, 2.0, 3.0};
+	Move.EndVelocity = {390.0, 0.0, 0.0};
+
+	TArray<uint8> Data;
+
+	FMemoryWriter Writer{Data};
+	FNameAsStringProxyArchive WriterArchive{Writer};
+
+	// Saving must not modify the move, since recorded moves are saved through a const reference.
+
+	const auto SavedMove{Move};
+	Move.Serialize(WriterArchive);
+
+	TestTrue(TEXT("Saving does not modify the move"), Move.StartCapsuleHalfHeight == SavedMove.StartCapsuleHalfHeight &&
+	                                                  Move.bStartCrouched == SavedMove.bStartCrouched &&
+	                                                  Move.bStartPrevWantsToCrouch == SavedMove.bStartPrevWantsToCrouch);
+
+	FMemoryReader Reader{Data};
+	FNameAsStringProxyArchive ReaderArchive{Reader};
+
+	FAlsRecordedMove LoadedMove;
+	LoadedMove.Serialize(ReaderArchive);
+
+	TestFalse(TEXT("Loading succeeded"), ReaderArchive.IsError());
+	TestEqual(TEXT("All data was read"), Reader.Tell(), static_cast<int64>(Data.Num()));
+
+	TestEqual(TEXT("Time stamp"), LoadedMove.TimeStamp, Move.TimeStamp);
+	TestEqual(TEXT("Compressed flags"), LoadedMove.CompressedFlags, Move.CompressedFlags);
+	TestEqual(TEXT("Custom movement mode"), LoadedMove.StartCustomMovementMode, Move.StartCustomMovementMode);
+	TestEqual(TEXT("Start location"), LoadedMove.StartLocation, Move.StartLocation);
+	TestEqual(TEXT("Start velocity"), LoadedMove.StartVelocity, Move.StartVelocity);
+	TestEqual(TEXT("Capsule half height"), LoadedMove.StartCapsuleHalfHeight, Move.StartCapsuleHalfHeight);
+	TestEqual(TEXT("Crouched"), static_cast<bool>(LoadedMove.bStartCrouched), static_cast<bool>(Move.bStartCrouched));
+	TestEqual(TEXT("Proned"), static_cast<bool>(LoadedMove.bStartProned), static_cast<bool>(Move.bStartProned));
+	TestEqual(TEXT("Wants to crouch"), static_cast<bool>(LoadedMove.bStartWantsToCrouch), static_cast<bool>(Move.bStartWantsToCrouch));
+	TestEqual(TEXT("Wants to prone"), static_cast<bool>(LoadedMove.bStartWantsToProne), static_cast<bool>(Move.bStartWantsToProne));
+	TestEqual(TEXT("Previous crouch input"), static_cast<bool>(LoadedMove.bStartPrevWantsToCrouch),
+	          static_cast<bool>(Move.bStartPrevWantsToCrouch));
+	TestEqual(TEXT("End location"), LoadedMove.EndLocation, Move.EndLocation);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMoveRecordingReplayTest, "Als.Movement.MoveRecording.Replay",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMoveRecordingReplayTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsMoveRecordingTests;
+
+	const TSubclassOf<AAlsCharacter> CharacterClass{LoadClass<AAlsCharacter>(nullptr, CharacterClassPath)};
+	if (!TestNotNull(TEXT("Character class is loaded"), CharacterClass.Get()))
+	{
+		return false;
+	}
+
+	auto* World{UWorld::CreateWorld(EWorldType::Game, false)};
+	GEngine->CreateNewWorldContext(EWorldType::Game).SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL{});
+	World->GetWorldSettings()->NotifyBeginPlay();
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	auto* FloorActor{World->SpawnActor<AActor>(FVector::ZeroVector, FRotator::ZeroRotator, SpawnParameters)};
+
+	auto* Floor{NewObject<UBoxComponent>(FloorActor)};
+	Floor->SetBoxExtent({2000.0, 2000.0, 10.0});
+	Floor->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	FloorActor->SetRootComponent(Floor);
+	Floor->RegisterComponent();
+
+	auto* Character{World->SpawnActor<AAlsCharacter>(CharacterClass, FVector{0.0, 0.0, 150.0}, FRotator::ZeroRotator, SpawnParameters)};
+	auto* Movement{IsValid(Character) ? Cast<UAlsCharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr};
+
+	if (TestNotNull(TEXT("Character is spawned"), Movement))
+	{
+		// Let the character apply its settings before recording, since replayed moves refresh the gait settings.
+
+		World->Tick(LEVELTICK_All, DeltaTime);
+
+		// Record a sequence that lands the character on the floor, then accelerates it along the floor and turns it.
+
+		Movement->ClearRecordedMoves();
+		Movement->SetRecordingMoves(true);
+
+		for (auto i{1}; i <= 90; i++)
+		{
+			const auto Acceleration{i <= 60 ? FVector{1000.0, 0.0, 0.0} : FVector{0.0, 1000.0, 0.0}};
+
+			AlsMoveAutonomousAccessor::Access(Movement, i * DeltaTime, DeltaTime, static_cast<uint8>(0), Acceleration);
+		}
+
+		Movement->SetRecordingMoves(false);
+
+		const auto Moves{Movement->GetRecordedMoves()};
+
+		TestEqual(TEXT("All moves are recorded"), Moves.Num(), 90);
+		TestTrue(TEXT("Character moves along the floor"), Movement->IsMovingOnGround() && !Movement->Velocity.IsNearlyZero());
+
+		// Put the character into a state that differs from the recorded one, so that it can be checked that it is restored.
+
+		Character->SetActorLocationAndRotation(FVector{500.0, -500.0, 150.0}, FRotator{0.0, 45.0, 0.0},
+		                                       false, nullptr, ETeleportType::TeleportPhysics);
+
+		Movement->SetMovementMode(MOVE_Falling);
+		Movement->Velocity = {0.0, 0.0, -200.0};
+		Movement->bWantsToCrouch = true;
+		Movement->SetStance(AlsStanceTags::Crouching);
+		Movement->SetMaxAllowedGait(AlsGaitTags::Walking);
+
+		const auto Location{Character->GetActorLocation()};
+		const auto Rotation{Character->GetActorRotation()};
+		const auto Velocity{Movement->Velocity};
+		const auto MovementMode{Movement->MovementMode};
+		const auto CapsuleHalfHeight{Character->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight()};
+		const auto Stance{Movement->GetStance()};
+		const auto MaxAllowedGait{Movement->GetMaxAllowedGait()};
+
+		const auto Result{Movement->ReplayMoves(Moves, 0.1f)};
+
+		AddInfo(FString::Printf(TEXT("Replayed %d moves, average move time %.4f ms, max location error %.4f cm."),
+		                        Result.MovesCount, Result.AverageMoveTime, Result.MaxLocationError));
+
+		TestEqual(TEXT("All moves are replayed"), Result.MovesCount, Moves.Num());
+		TestEqual(TEXT("Replayed moves match the recorded ones"), Result.MismatchedMovesCount, 0);
+		TestTrue(TEXT("Floor is queried"), Result.FloorQueriesCount > 0);
+
+		TestTrue(TEXT("Location is restored"), Character->GetActorLocation().Equals(Location, UE_KINDA_SMALL_NUMBER));
+		TestTrue(TEXT("Rotation is restored"), Character->GetActorRotation().Equals(Rotation, UE_KINDA_SMALL_NUMBER));
+		TestTrue(TEXT("Velocity is restored"), Movement->Velocity.Equals(Velocity, UE_KINDA_SMALL_NUMBER));
+		TestEqual(TEXT("Movement mode is restored"), static_cast<int32>(Movement->MovementMode), static_cast<int32>(MovementMode));
+		TestTrue(TEXT("Crouch input is restored"), Movement->bWantsToCrouch);
+		TestEqual(TEXT("Capsule half height is restored"),
+		          Character->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight(), CapsuleHalfHeight);
+		TestEqual(TEXT("Stance is restored"), Movement->GetStance().ToString(), Stance.ToString());
+		TestEqual(TEXT("Max allowed gait is restored"), Movement->GetMaxAllowedGait().ToString(), MaxAllowedGait.ToString());
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,300 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Settings/AlsPoseHistorySettings.h"
+#include "State/AlsPoseHistory.h"
+
+namespace AlsPoseHistoryTests
+{
+	static const auto* SkeletalMeshPath{TEXT("/ALS/ALSManny/Characters/Mannequins/Meshes/SK_Mannequin.SK_Mannequin")};
+
+	static constexpr auto CharactersCount{100};
+
+	static constexpr auto RecordingRate{60.0f};
+
+	// Creates a game world with a mannequin mesh, which is shared by all histories, since they only read its pose.
+
+	struct FTestEnvironment
+	{
+		UWorld* World{nullptr};
+
+		USkeletalMeshComponent* Mesh{nullptr};
+
+		FAlsPoseHistorySettings Settings;
+
+		FTestEnvironment()
+		{
+			auto* SkeletalMesh{LoadObject<USkeletalMesh>(nullptr, SkeletalMeshPath)};
+			if (SkeletalMesh == nullptr)
+			{
+				return;
+			}
+
+			World = UWorld::CreateWorld(EWorldType::Game, false);
+			GEngine->CreateNewWorldContext(EWorldType::Game).SetCurrentWorld(World);
+
+			FActorSpawnParameters SpawnParameters;
+			SpawnParameters.ObjectFlags |= RF_Transient;
+
+			auto* Actor{World->SpawnActor<AActor>(FVector::ZeroVector, FRotator::ZeroRotator, SpawnParameters)};
+
+			Mesh = NewObject<USkeletalMeshComponent>(Actor);
+			Mesh->SetSkeletalMeshAsset(SkeletalMesh);
+			Actor->SetRootComponent(Mesh);
+			Mesh->RegisterComponent();
+			Mesh->RefreshBoneTransforms();
+			Mesh->FinalizeBoneTransform();
+
+			Settings.HistoryDuration = 1.0f;
+			Settings.MaxRecordingRate = RecordingRate;
+			Settings.BoneNames = {
+				TEXT("pelvis"), TEXT("spine_01"), TEXT("spine_02"), TEXT("spine_03"), TEXT("spine_04"),
+				TEXT("spine_05"), TEXT("neck_01"), TEXT("head"), TEXT("clavicle_l"), TEXT("upperarm_l"),
+				TEXT("lowerarm_l"), TEXT("hand_l"), TEXT("clavicle_r"), TEXT("upperarm_r"), TEXT("lowerarm_r"),
+				TEXT("hand_r"), TEXT("thigh_l"), TEXT("calf_l"), TEXT("thigh_r"), TEXT("calf_r")
+			};
+		}
+
+		~FTestEnvironment()
+		{
+			if (World != nullptr)
+			{
+				GEngine->DestroyWorldContext(World);
+				World->DestroyWorld(false);
+			}
+		}
+
+		static FTransform GetCapsuleTransform(const double Time)
+		{
+			return {FRotator{0.0, Time * 90.0, 0.0}, FVector{Time * 600.0, 0.0, 90.0}};
+		}
+
+		// Fills the histories of all characters, as if they were recorded during one second of the server time.
+		void FillHistories(TArray<FAlsPoseHistory>& Histories, const bool bRecordBones) const
+		{
+			Histories.SetNum(CharactersCount);
+
+			for (auto& History : Histories)
+			{
+				History.Initialize(*Mesh, Settings);
+			}
+
+			const auto FramesCount{FMath::CeilToInt(Settings.HistoryDuration * RecordingRate) + 1};
+
+			for (auto Frame{0}; Frame < FramesCount; Frame++)
+			{
+				const auto Time{Frame / static_cast<double>(RecordingRate)};
+				const auto CapsuleTransform{GetCapsuleTransform(Time)};
+
+				for (auto& History : Histories)
+				{
+					History.Record(Time, CapsuleTransform, 90.0f);
+
+					if (bRecordBones)
+					{
+						History.RecordBones(Time, CapsuleTransform, 90.0f, *Mesh);
+					}
+				}
+			}
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsPoseHistoryMemoryTest, "Als.Character.PoseHistory.Memory",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsPoseHistoryMemoryTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsPoseHistoryTests;
+
+	const FTestEnvironment Environment;
+	if (!TestNotNull(TEXT("Mesh is created"), Environment.Mesh))
+	{
+		return false;
+	}
+
+	TArray<FAlsPoseHistory> Histories;
+	Environment.FillHistories(Histories, true);
+
+	SIZE_T AllocatedSize{0};
+
+	for (const auto& History : Histories)
+	{
+		AllocatedSize += History.GetAllocatedSize();
+	}
+
+	// 61 frames of 20 bones each, plus the latest pose, the bone indices and the bone names. Some slack is allowed for the allocator.
+
+	const auto BonesCount{Environment.Settings.BoneNames.Num()};
+	const auto FramesCount{FMath::CeilToInt(Environment.Settings.HistoryDuration * RecordingRate) + 1};
+
+	const SIZE_T ExpectedHistorySize{
+		FramesCount * (sizeof(FAlsPoseHistoryFrame) + BonesCount * sizeof(FAlsPoseHistoryBone)) +
+		BonesCount * (sizeof(FAlsPoseHistoryBone) + sizeof(int32) + sizeof(FName))
+	};
+
+	AddInfo(FString::Printf(TEXT("Pose history of %d characters takes %.2f KB."), CharactersCount, AllocatedSize / 1024.0));
+
+	TestTrue(TEXT("All bones are recorded"), Histories[0].GetBonesCount() == BonesCount);
+	TestTrue(TEXT("History size stays within its budget"), AllocatedSize <= ExpectedHistorySize * CharactersCount * 5 / 4);
+
+	// Recording more frames than the history can hold must not allocate any more memory.
+
+	for (auto& History : Histories)
+	{
+		History.Record(100.0, FTransform::Identity, 90.0f);
+	}
+
+	SIZE_T AllocatedSizeAfterRecording{0};
+
+	for (const auto& History : Histories)
+	{
+		AllocatedSizeAfterRecording += History.GetAllocatedSize();
+	}
+
+	TestTrue(TEXT("Recording doesn't allocate memory"), AllocatedSizeAfterRecording == AllocatedSize);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsPoseHistoryQueryCostTest, "Als.Character.PoseHistory.QueryCost",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsPoseHistoryQueryCostTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsPoseHistoryTests;
+
+	const FTestEnvironment Environment;
+	if (!TestNotNull(TEXT("Mesh is created"), Environment.Mesh))
+	{
+		return false;
+	}
+
+	TArray<FAlsPoseHistory> Histories;
+	Environment.FillHistories(Histories, true);
+
+	// Simulate a hit validation query for each character, several times per frame.
+
+	static constexpr auto QueriesPerCharacter{100};
+
+	FRandomStream RandomStream{12345};
+
+	FTransform CapsuleTransform;
+	float CapsuleHalfHeight;
+	TArray<FTransform> BoneTransforms;
+
+	auto SucceededQueriesCount{0};
+
+	const auto StartTime{FPlatformTime::Seconds()};
+
+	for (auto i{0}; i < QueriesPerCharacter; i++)
+	{
+		for (const auto& History : Histories)
+		{
+			SucceededQueriesCount += History.TryGetPose(RandomStream.FRandRange(0.0f, Environment.Settings.HistoryDuration),
+			                                             CapsuleTransform, CapsuleHalfHeight, BoneTransforms) ? 1 : 0;
+		}
+	}
+
+	const auto QueriesCount{QueriesPerCharacter * CharactersCount};
+	const auto QueryTime{(FPlatformTime::Seconds() - StartTime) / QueriesCount};
+
+	AddInfo(FString::Printf(TEXT("Pose history query takes %.3f us on average."), QueryTime * 1000000.0));
+
+	TestEqual(TEXT("All queries succeed"), SucceededQueriesCount, QueriesCount);
+	TestEqual(TEXT("All bones are returned"), BoneTransforms.Num(), Environment.Settings.BoneNames.Num());
+
+	// The limit is generous, so that the test doesn't fail on slow machines, but still catches a regression to a linear search.
+
+	TestTrue(TEXT("Query is cheap"), QueryTime < 50.0 / 1000000.0);
+
+	// A query at the time of a recorded frame must return that frame.
+
+	const auto FrameTime{30.0 / RecordingRate};
+	const auto ExpectedCapsuleTransform{FTestEnvironment::GetCapsuleTransform(FrameTime)};
+
+	if (TestTrue(TEXT("Query at a frame time succeeds"),
+	             Histories[0].TryGetPose(FrameTime, CapsuleTransform, CapsuleHalfHeight, BoneTransforms)))
+	{
+		TestTrue(TEXT("Capsule location matches the recorded one"),
+		         CapsuleTransform.GetLocation().Equals(ExpectedCapsuleTransform.GetLocation(), UE_KINDA_SMALL_NUMBER));
+
+		TestTrue(TEXT("Capsule rotation matches the recorded one"),
+		         CapsuleTransform.GetRotation().Equals(ExpectedCapsuleTransform.GetRotation(), 0.001));
+
+		TestEqual(TEXT("Capsule half height matches the recorded one"), CapsuleHalfHeight, 90.0f);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsPoseHistoryCapsuleOnlyTest, "Als.Character.PoseHistory.CapsuleOnly",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsPoseHistoryCapsuleOnlyTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsPoseHistoryTests;
+
+	const FTestEnvironment Environment;
+	if (!TestNotNull(TEXT("Mesh is created"), Environment.Mesh))
+	{
+		return false;
+	}
+
+	// On a dedicated server, the pose may never be refreshed, but the capsule must still be recorded.
+
+	TArray<FAlsPoseHistory> Histories;
+	Environment.FillHistories(Histories, false);
+
+	FTransform CapsuleTransform;
+	float CapsuleHalfHeight;
+	TArray<FTransform> BoneTransforms;
+
+	TestTrue(TEXT("Frames are recorded without pose refreshes"), Histories[0].GetFramesCount() > 0);
+
+	if (TestTrue(TEXT("Query succeeds without pose refreshes"),
+	             Histories[0].TryGetPose(0.5, CapsuleTransform, CapsuleHalfHeight, BoneTransforms)))
+	{
+		TestTrue(TEXT("Capsule location matches the recorded one"),
+		         CapsuleTransform.GetLocation().Equals(FTestEnvironment::GetCapsuleTransform(0.5).GetLocation(), UE_KINDA_SMALL_NUMBER));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsPoseHistoryMissingBonesTest, "Als.Character.PoseHistory.MissingBones",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsPoseHistoryMissingBonesTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsPoseHistoryTests;
+
+	FTestEnvironment Environment;
+	if (!TestNotNull(TEXT("Mesh is created"), Environment.Mesh))
+	{
+		return false;
+	}
+
+	Environment.Settings.BoneNames = {TEXT("pelvis"), TEXT("missing_bone"), TEXT("head")};
+
+	AddExpectedMessage(TEXT("missing_bone"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 1);
+
+	FAlsPoseHistory History;
+	History.Initialize(*Environment.Mesh, Environment.Settings);
+
+	TestEqual(TEXT("Missing bone is skipped"), History.GetBonesCount(), 2);
+	TestTrue(TEXT("Remaining bones keep their order"),
+	         History.GetBoneNames() == TArray<FName>{TEXT("pelvis"), TEXT("head")});
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,274 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && UE_WITH_IRIS
+
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializationContext.h"
+#include "Net/AlsRagdollBodyPoseNetSerializer.h"
+#include "State/AlsRagdollPose.h"
+
+namespace AlsRagdollBodyPoseNetSerializerTests
+{
+	using namespace UE::Net;
+
+	static constexpr auto BufferSize{64};
+
+	struct alignas(16) FQuantizedBuffer
+	{
+		uint8 Data[BufferSize]{};
+	};
+
+	static const FNetSerializer& GetSerializer()
+	{
+		return UE_NET_GET_SERIALIZER(FAlsRagdollBodyPoseNetSerializer);
+	}
+
+	static const FNetSerializerConfig* GetConfig()
+	{
+		return GetSerializer().DefaultConfig;
+	}
+
+	static void Quantize(const FAlsRagdollBodyPose& Source, FQuantizedBuffer& Target)
+	{
+		FNetSerializationContext Context;
+
+		FNetQuantizeArgs Arguments;
+		Arguments.Version = GetSerializer().Version;
+		Arguments.NetSerializerConfig = GetConfig();
+		Arguments.Source = NetSerializerValuePointer(&Source);
+		Arguments.Target = NetSerializerValuePointer(&Target);
+
+		GetSerializer().Quantize(Context, Arguments);
+	}
+
+	static FAlsRagdollBodyPose Dequantize(const FQuantizedBuffer& Source)
+	{
+		FAlsRagdollBodyPose Target;
+		FNetSerializationContext Context;
+
+		FNetDequantizeArgs Arguments;
+		Arguments.Version = GetSerializer().Version;
+		Arguments.NetSerializerConfig = GetConfig();
+		Arguments.Source = NetSerializerValuePointer(&Source);
+		Arguments.Target = NetSerializerValuePointer(&Target);
+
+		GetSerializer().Dequantize(Context, Arguments);
+
+		return Target;
+	}
+
+	static bool IsQuantizedEqual(const FQuantizedBuffer& Value0, const FQuantizedBuffer& Value1)
+	{
+		FNetSerializationContext Context;
+
+		FNetIsEqualArgs Arguments;
+		Arguments.Version = GetSerializer().Version;
+		Arguments.NetSerializerConfig = GetConfig();
+		Arguments.Source0 = NetSerializerValuePointer(&Value0);
+		Arguments.Source1 = NetSerializerValuePointer(&Value1);
+		Arguments.bStateIsQuantized = true;
+
+		return GetSerializer().IsEqual(Context, Arguments);
+	}
+
+	// Writes the value, optionally delta compressed against the previous value, reads it back and returns the number of written bits.
+
+	static uint32 WriteAndRead(const FQuantizedBuffer& Value, const FQuantizedBuffer* PreviousValue,
+	                           FQuantizedBuffer& ReadValue, bool& bSuccess)
+	{
+		uint8 StreamBuffer[BufferSize]{};
+
+		FNetBitStreamWriter Writer;
+		Writer.InitBytes(StreamBuffer, BufferSize);
+
+		FNetSerializationContext WriterContext{&Writer};
+
+		if (PreviousValue != nullptr)
+		{
+			FNetSerializeDeltaArgs Arguments;
+			Arguments.Version = GetSerializer().Version;
+			Arguments.NetSerializerConfig = GetConfig();
+			Arguments.Source = NetSerializerValuePointer(&Value);
+			Arguments.Prev = NetSerializerValuePointer(PreviousValue);
+
+			GetSerializer().SerializeDelta(WriterContext, Arguments);
+		}
+		else
+		{
+			FNetSerializeArgs Arguments;
+			Arguments.Version = GetSerializer().Version;
+			Arguments.NetSerializerConfig = GetConfig();
+			Arguments.Source = NetSerializerValuePointer(&Value);
+
+			GetSerializer().Serialize(WriterContext, Arguments);
+		}
+
+		Writer.CommitWrites();
+
+		const auto BitsCount{Writer.GetPosBits()};
+
+		FNetBitStreamReader Reader;
+		Reader.InitBits(StreamBuffer, BitsCount);
+
+		FNetSerializationContext ReaderContext{&Reader};
+
+		if (PreviousValue != nullptr)
+		{
+			FNetDeserializeDeltaArgs Arguments;
+			Arguments.Version = GetSerializer().Version;
+			Arguments.NetSerializerConfig = GetConfig();
+			Arguments.Target = NetSerializerValuePointer(&ReadValue);
+			Arguments.Prev = NetSerializerValuePointer(PreviousValue);
+
+			GetSerializer().DeserializeDelta(ReaderContext, Arguments);
+		}
+		else
+		{
+			FNetDeserializeArgs Arguments;
+			Arguments.Version = GetSerializer().Version;
+			Arguments.NetSerializerConfig = GetConfig();
+			Arguments.Target = NetSerializerValuePointer(&ReadValue);
+
+			GetSerializer().Deserialize(ReaderContext, Arguments);
+		}
+
+		bSuccess = !WriterContext.HasErrorOrOverflow() && !ReaderContext.HasErrorOrOverflow() &&
+		           Reader.GetPosBits() == BitsCount;
+
+		return BitsCount;
+	}
+
+	static FAlsRagdollBodyPose MakeBodyPose(const FVector& Location, const FRotator& Rotation)
+	{
+		FAlsRagdollBodyPose BodyPose;
+		BodyPose.Location = Location;
+		BodyPose.Rotation = Rotation;
+
+		return BodyPose;
+	}
+
+	static const FAlsRagdollBodyPose TestBodyPoses[]{
+		MakeBodyPose(FVector::ZeroVector, FRotator::ZeroRotator),
+		MakeBodyPose({12.34, -56.78, 90.12}, {10.0, 20.0, 30.0}),
+		MakeBodyPose({-0.04, 0.05, 0.06}, {-89.9, 179.9, -179.9}),
+		MakeBodyPose({-12345.67, 8765.43, -100.0}, {359.0, -360.0, 720.5})
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsRagdollBodyPoseNetSerializerQuantizeTest, "Als.Net.RagdollBodyPoseNetSerializer.Quantize",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsRagdollBodyPoseNetSerializerQuantizeTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsRagdollBodyPoseNetSerializerTests;
+
+	if (!TestTrue(TEXT("Quantized type fits into the test buffer"),
+	              GetSerializer().QuantizedTypeSize <= BufferSize && GetSerializer().QuantizedTypeAlignment <= 16))
+	{
+		return false;
+	}
+
+	for (const auto& BodyPose : TestBodyPoses)
+	{
+		// The dequantized value must match FAlsRagdollBodyPose::Quantize(), which is used
+		// on the authority to decide whether the body has changed and needs to be replicated.
+
+		auto ExpectedBodyPose{BodyPose};
+		ExpectedBodyPose.Quantize();
+
+		FQuantizedBuffer QuantizedBodyPose;
+		Quantize(BodyPose, QuantizedBodyPose);
+
+		const auto DequantizedBodyPose{Dequantize(QuantizedBodyPose)};
+
+		TestTrue(TEXT("Dequantized location matches the legacy precision"),
+		         DequantizedBodyPose.Location.Equals(ExpectedBodyPose.Location, UE_KINDA_SMALL_NUMBER));
+
+		TestTrue(TEXT("Dequantized rotation matches the legacy precision"),
+		         DequantizedBodyPose.Rotation.Equals(ExpectedBodyPose.Rotation, UE_KINDA_SMALL_NUMBER));
+
+		// Quantizing an already quantized value must not change it, otherwise the value will be considered dirty forever.
+
+		FQuantizedBuffer RequantizedBodyPose;
+		Quantize(DequantizedBodyPose, RequantizedBodyPose);
+
+		TestTrue(TEXT("Requantized value is equal"), IsQuantizedEqual(QuantizedBodyPose, RequantizedBodyPose));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsRagdollBodyPoseNetSerializerRoundTripTest, "Als.Net.RagdollBodyPoseNetSerializer.RoundTrip",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsRagdollBodyPoseNetSerializerRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsRagdollBodyPoseNetSerializerTests;
+
+	for (const auto& BodyPose : TestBodyPoses)
+	{
+		FQuantizedBuffer QuantizedBodyPose;
+		Quantize(BodyPose, QuantizedBodyPose);
+
+		FQuantizedBuffer ReadBodyPose;
+		bool bSuccess;
+		WriteAndRead(QuantizedBodyPose, nullptr, ReadBodyPose, bSuccess);
+
+		TestTrue(TEXT("Serialization succeeded"), bSuccess);
+		TestTrue(TEXT("Deserialized value is equal"), IsQuantizedEqual(QuantizedBodyPose, ReadBodyPose));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsRagdollBodyPoseNetSerializerDeltaRoundTripTest,
+                                 "Als.Net.RagdollBodyPoseNetSerializer.DeltaRoundTrip",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsRagdollBodyPoseNetSerializerDeltaRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsRagdollBodyPoseNetSerializerTests;
+
+	for (const auto& PreviousBodyPose : TestBodyPoses)
+	{
+		FQuantizedBuffer QuantizedPreviousBodyPose;
+		Quantize(PreviousBodyPose, QuantizedPreviousBodyPose);
+
+		for (const auto& BodyPose : TestBodyPoses)
+		{
+			FQuantizedBuffer QuantizedBodyPose;
+			Quantize(BodyPose, QuantizedBodyPose);
+
+			FQuantizedBuffer ReadBodyPose;
+			bool bSuccess;
+			WriteAndRead(QuantizedBodyPose, &QuantizedPreviousBodyPose, ReadBodyPose, bSuccess);
+
+			TestTrue(TEXT("Delta serialization succeeded"), bSuccess);
+			TestTrue(TEXT("Delta deserialized value is equal"), IsQuantizedEqual(QuantizedBodyPose, ReadBodyPose));
+		}
+	}
+
+	// A small movement with an unchanged rotation must take fewer bits than the full state.
+
+	FQuantizedBuffer QuantizedPreviousBodyPose;
+	Quantize(MakeBodyPose({10.0, 20.0, 30.0}, {10.0, 20.0, 30.0}), QuantizedPreviousBodyPose);
+
+	FQuantizedBuffer QuantizedBodyPose;
+	Quantize(MakeBodyPose({10.5, 19.5, 30.0}, {10.0, 20.0, 30.0}), QuantizedBodyPose);
+
+	FQuantizedBuffer ReadBodyPose;
+	bool bFullSuccess;
+	bool bDeltaSuccess;
+
+	const auto FullBitsCount{WriteAndRead(QuantizedBodyPose, nullptr, ReadBodyPose, bFullSuccess)};
+	const auto DeltaBitsCount{WriteAndRead(QuantizedBodyPose, &QuantizedPreviousBodyPose, ReadBodyPose, bDeltaSuccess)};
+
+	TestTrue(TEXT("Serialization succeeded"), bFullSuccess && bDeltaSuccess);
+	TestTrue(FString::Printf(TEXT("Delta state takes fewer bits (%u) than the full state (%u)"), DeltaBitsCount, FullBitsCount),
+	         DeltaBitsCount < FullBitsCount);
+
+	return true;
+}
+
+#endif
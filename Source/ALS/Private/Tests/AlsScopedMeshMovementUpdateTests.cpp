@@ -0,0 +1,368 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AlsCharacter.h"
+#include "AlsCharacterMovementComponent.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsPrivateMemberAccessor.h"
+#include "Utility/AlsScopedMeshMovementUpdate.h"
+
+// Replayed moves are performed by MoveAutonomous(), the same way the server processes received client moves.
+
+ALS_DEFINE_PRIVATE_MEMBER_ACCESSOR(AlsScopedMeshMovementUpdateMoveAutonomousAccessor, &UAlsCharacterMovementComponent::MoveAutonomous,
+                                   void (UAlsCharacterMovementComponent::*)(float, float, uint8, const FVector&))
+
+namespace AlsScopedMeshMovementUpdateTests
+{
+	static const auto* CharacterClassPath{TEXT("/ALS/ALSManny/Characters/B_AlsManny_Character.B_AlsManny_Character_C")};
+
+	static constexpr auto DeltaTime{1.0f / 60.0f};
+
+	// Creates a game world with a floor, an ALS character standing on it, whose mesh has
+	// an attached component, and a movable platform to base the character on.
+
+	struct FTestEnvironment
+	{
+		UWorld* World{nullptr};
+
+		AAlsCharacter* Character{nullptr};
+
+		USceneComponent* MeshChild{nullptr};
+
+		UBoxComponent* Platform{nullptr};
+
+		IConsoleVariable* DeferVariable{nullptr};
+
+		bool bPreviousDefer{false};
+
+		FTestEnvironment()
+		{
+			DeferVariable = IConsoleManager::Get().FindConsoleVariable(TEXT("als.Movement.DeferMeshMovementDuringReplay"));
+			bPreviousDefer = DeferVariable != nullptr && DeferVariable->GetBool();
+
+			World = UWorld::CreateWorld(EWorldType::Game, false);
+			GEngine->CreateNewWorldContext(EWorldType::Game).SetCurrentWorld(World);
+
+			World->InitializeActorsForPlay(FURL{});
+			World->GetWorldSettings()->NotifyBeginPlay();
+
+			FActorSpawnParameters SpawnParameters;
+			SpawnParameters.ObjectFlags |= RF_Transient;
+			SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			SpawnBox(FVector::ZeroVector, {2000.0, 2000.0, 10.0});
+
+			const TSubclassOf<AAlsCharacter> CharacterClass{LoadClass<AAlsCharacter>(nullptr, CharacterClassPath)};
+			if (CharacterClass != nullptr)
+			{
+				Character = World->SpawnActor<AAlsCharacter>(CharacterClass, FVector{0.0, 0.0, 110.0},
+				                                             FRotator::ZeroRotator, SpawnParameters);
+			}
+
+			if (IsValid(Character))
+			{
+				MeshChild = NewObject<USceneComponent>(Character);
+				MeshChild->SetupAttachment(Character->GetMesh());
+				MeshChild->SetRelativeLocation({10.0, 20.0, 30.0});
+				MeshChild->RegisterComponent();
+
+				// Let the character land and apply its settings.
+
+				for (auto i{0}; i < 10; i++)
+				{
+					World->Tick(LEVELTICK_All, DeltaTime);
+				}
+			}
+
+			auto* PlatformActor{World->SpawnActor<AActor>(FVector{0.0, 0.0, -1000.0}, FRotator::ZeroRotator, SpawnParameters)};
+
+			Platform = NewObject<UBoxComponent>(PlatformActor);
+			Platform->SetMobility(EComponentMobility::Movable);
+			PlatformActor->SetRootComponent(Platform);
+			Platform->RegisterComponent();
+		}
+
+		~FTestEnvironment()
+		{
+			SetDefer(bPreviousDefer);
+
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+
+		bool IsReady(FAutomationTestBase& Test) const
+		{
+			return Test.TestNotNull(TEXT("Character is spawned"), Character) &&
+			       Test.TestNotNull(TEXT("Console variable exists"), DeferVariable);
+		}
+
+		UBoxComponent* SpawnBox(const FVector& Location, const FVector& Extent) const
+		{
+			FActorSpawnParameters SpawnParameters;
+			SpawnParameters.ObjectFlags |= RF_Transient;
+
+			auto* BoxActor{World->SpawnActor<AActor>(Location, FRotator::ZeroRotator, SpawnParameters)};
+
+			auto* Box{NewObject<UBoxComponent>(BoxActor)};
+			Box->SetBoxExtent(Extent);
+			Box->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+			BoxActor->SetRootComponent(Box);
+			Box->RegisterComponent();
+
+			return Box;
+		}
+
+		void SetDefer(const bool bDefer) const
+		{
+			if (DeferVariable != nullptr)
+			{
+				DeferVariable->Set(bDefer, ECVF_SetByCode);
+			}
+		}
+
+		bool AreTransformsConsistent() const
+		{
+			const auto* Mesh{Character->GetMesh()};
+
+			const auto ExpectedMeshLocation{
+				Character->GetCapsuleComponent()->GetComponentTransform().TransformPosition(Mesh->GetRelativeLocation())
+			};
+
+			const auto ExpectedChildLocation{Mesh->GetComponentTransform().TransformPosition(MeshChild->GetRelativeLocation())};
+
+			return Mesh->GetComponentLocation().Equals(ExpectedMeshLocation, UE_KINDA_SMALL_NUMBER) &&
+			       MeshChild->GetComponentLocation().Equals(ExpectedChildLocation, UE_KINDA_SMALL_NUMBER);
+		}
+
+		// Starts mantling onto an obstacle in front of the character and replays the mantling moves in a single
+		// scope, as it is done after a server correction. Returns false if mantling could not be started.
+
+		bool ReplayMantling(FAutomationTestBase& Test, const bool bDefer, FTransform& ActorTransform) const
+		{
+			SetDefer(bDefer);
+
+			SpawnBox({130.0, 0.0, 60.0}, {50.0, 200.0, 50.0});
+
+			if (!Test.TestTrue(TEXT("Mantling is started"), Character->StartMantlingGrounded() &&
+			                                                Character->GetLocomotionAction() == AlsLocomotionActionTags::Mantling))
+			{
+				return false;
+			}
+
+			auto* Movement{Cast<UAlsCharacterMovementComponent>(Character->GetCharacterMovement())};
+
+			const auto StartLocation{Character->GetActorLocation()};
+
+			{
+				FAlsScopedMeshMovementUpdate ScopedMeshUpdate{Character->GetMesh()};
+
+				Test.AddInfo(FString::Printf(TEXT("Mesh movement is %s while mantling."),
+				                             Character->GetMesh()->IsDeferringMovementUpdates() ? TEXT("deferred") : TEXT("not deferred")));
+
+				for (auto i{1}; i <= 30; i++)
+				{
+					AlsScopedMeshMovementUpdateMoveAutonomousAccessor::Access(Movement, World->GetTimeSeconds() + i * DeltaTime,
+					                                                          DeltaTime, static_cast<uint8>(0), FVector::ZeroVector);
+				}
+			}
+
+			ActorTransform = Character->GetActorTransform();
+
+			Test.TestFalse(TEXT("Character is moved by mantling"), ActorTransform.GetLocation().Equals(StartLocation, 1.0));
+			return true;
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsScopedMeshMovementUpdateTeleportTest, "Als.Movement.ScopedMeshMovementUpdate.Teleport",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsScopedMeshMovementUpdateTeleportTest::RunTest(const FString& Parameters)
+{
+	AlsScopedMeshMovementUpdateTests::FTestEnvironment Environment;
+	if (!Environment.IsReady(*this))
+	{
+		return false;
+	}
+
+	Environment.SetDefer(true);
+
+	auto* Capsule{Environment.Character->GetCapsuleComponent()};
+
+	{
+		FAlsScopedMeshMovementUpdate ScopedMeshUpdate{Environment.Character->GetMesh()};
+
+		TestTrue(TEXT("Mesh movement is deferred"), Environment.Character->GetMesh()->IsDeferringMovementUpdates());
+
+		Capsule->SetWorldLocation({50.0, 0.0, 100.0});
+		Capsule->SetWorldLocationAndRotation({5000.0, -3000.0, 200.0}, FRotator{0.0, 135.0, 0.0},
+		                                     false, nullptr, ETeleportType::TeleportPhysics);
+		Capsule->SetWorldLocation({5010.0, -3000.0, 200.0});
+	}
+
+	TestTrue(TEXT("Mesh and its children follow the teleported capsule"), Environment.AreTransformsConsistent());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsScopedMeshMovementUpdateBaseChangeTest, "Als.Movement.ScopedMeshMovementUpdate.BaseChange",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsScopedMeshMovementUpdateBaseChangeTest::RunTest(const FString& Parameters)
+{
+	AlsScopedMeshMovementUpdateTests::FTestEnvironment Environment;
+	if (!Environment.IsReady(*this))
+	{
+		return false;
+	}
+
+	Environment.SetDefer(true);
+
+	auto* Capsule{Environment.Character->GetCapsuleComponent()};
+
+	{
+		FAlsScopedMeshMovementUpdate ScopedMeshUpdate{Environment.Character->GetMesh()};
+
+		Environment.Character->SetBase(Environment.Platform);
+
+		Environment.Platform->SetWorldLocationAndRotation({100.0, 100.0, 0.0}, FRotator{0.0, 90.0, 0.0});
+		Capsule->SetWorldLocationAndRotation({100.0, 100.0, 100.0}, FRotator{0.0, 90.0, 0.0});
+
+		Environment.Character->SetBase(nullptr);
+
+		Capsule->SetWorldLocation({150.0, 100.0, 100.0});
+	}
+
+	TestTrue(TEXT("Mesh and its children follow the capsule after base changes"), Environment.AreTransformsConsistent());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsScopedMeshMovementUpdateRootMotionTest, "Als.Movement.ScopedMeshMovementUpdate.RootMotion",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsScopedMeshMovementUpdateRootMotionTest::RunTest(const FString& Parameters)
+{
+	AlsScopedMeshMovementUpdateTests::FTestEnvironment Environment;
+	if (!Environment.IsReady(*this))
+	{
+		return false;
+	}
+
+	Environment.SetDefer(true);
+
+	// Animation root motion is converted to world space using the mesh transform,
+	// so the mesh must stay up to date while the root motion montage is resimulated.
+
+	Environment.Character->bClientResimulateRootMotion = true;
+
+	{
+		FAlsScopedMeshMovementUpdate ScopedMeshUpdate{Environment.Character->GetMesh()};
+
+		TestFalse(TEXT("Mesh movement is not deferred while root motion is resimulated"),
+		          Environment.Character->GetMesh()->IsDeferringMovementUpdates());
+
+		Environment.Character->GetCapsuleComponent()->SetWorldLocation({200.0, 0.0, 100.0});
+
+		TestTrue(TEXT("Mesh and its children are updated immediately"), Environment.AreTransformsConsistent());
+	}
+
+	Environment.Character->bClientResimulateRootMotion = false;
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsScopedMeshMovementUpdateRagdollingTest, "Als.Movement.ScopedMeshMovementUpdate.Ragdolling",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsScopedMeshMovementUpdateRagdollingTest::RunTest(const FString& Parameters)
+{
+	AlsScopedMeshMovementUpdateTests::FTestEnvironment Environment;
+	if (!Environment.IsReady(*this))
+	{
+		return false;
+	}
+
+	Environment.SetDefer(true);
+
+	auto* Mesh{Environment.Character->GetMesh()};
+
+	// The mesh is detached from the capsule when ragdolling starts.
+
+	Mesh->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+
+	const auto MeshLocation{Mesh->GetComponentLocation()};
+
+	{
+		FAlsScopedMeshMovementUpdate ScopedMeshUpdate{Mesh};
+
+		TestFalse(TEXT("Detached mesh movement is not deferred"), Mesh->IsDeferringMovementUpdates());
+
+		Environment.Character->GetCapsuleComponent()->SetWorldLocation({300.0, 0.0, 100.0});
+	}
+
+	TestTrue(TEXT("Detached mesh stays in place"), Mesh->GetComponentLocation().Equals(MeshLocation, UE_KINDA_SMALL_NUMBER));
+
+	// Ragdolling ends by attaching the mesh back, after which the deferral is allowed again.
+
+	Mesh->AttachToComponent(Environment.Character->GetCapsuleComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+
+	{
+		FAlsScopedMeshMovementUpdate ScopedMeshUpdate{Mesh};
+
+		TestTrue(TEXT("Reattached mesh movement is deferred"), Mesh->IsDeferringMovementUpdates());
+
+		Environment.Character->GetCapsuleComponent()->SetWorldLocation({350.0, 0.0, 100.0});
+	}
+
+	TestTrue(TEXT("Reattached mesh and its children follow the capsule"), Environment.AreTransformsConsistent());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsScopedMeshMovementUpdateMantlingTest, "Als.Movement.ScopedMeshMovementUpdate.Mantling",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsScopedMeshMovementUpdateMantlingTest::RunTest(const FString& Parameters)
+{
+	// Mantling moves the character using a root motion source, which doesn't depend on the mesh transform,
+	// so the replay must end up in the same place regardless of whether the mesh movement is deferred.
+
+	FTransform ImmediateTransform;
+	FTransform DeferredTransform;
+
+	{
+		AlsScopedMeshMovementUpdateTests::FTestEnvironment Environment;
+		if (!Environment.IsReady(*this) || !Environment.ReplayMantling(*this, false, ImmediateTransform))
+		{
+			return false;
+		}
+	}
+
+	AlsScopedMeshMovementUpdateTests::FTestEnvironment Environment;
+	if (!Environment.IsReady(*this) || !Environment.ReplayMantling(*this, true, DeferredTransform))
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("Deferred replay ends at the same location"),
+	         DeferredTransform.GetLocation().Equals(ImmediateTransform.GetLocation(), UE_KINDA_SMALL_NUMBER));
+
+	TestTrue(TEXT("Deferred replay ends with the same rotation"),
+	         DeferredTransform.GetRotation().Equals(ImmediateTransform.GetRotation(), UE_KINDA_SMALL_NUMBER));
+
+	TestTrue(TEXT("Mesh and its children follow the mantling capsule"), Environment.AreTransformsConsistent());
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,286 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "State/AlsLocomotionState.h"
+
+namespace AlsVelocityNetworkSmoothingTests
+{
+	static constexpr auto FrameDeltaTime{1.0f / 60.0f};
+
+	static constexpr auto MaxServerDeltaTime{0.5f};
+
+	static constexpr auto MaxExtrapolationTime{0.25f};
+
+	static constexpr auto MaxSpeed{600.0f};
+
+	// Velocity and acceleration of a character that starts running, turns by 90 degrees and then stops.
+
+	static void GetRunningVelocity(const double Time, FVector& Velocity, FVector& Acceleration)
+	{
+		static constexpr auto MaxAcceleration{2000.0};
+		static constexpr auto TurnStartTime{1.5};
+		static constexpr auto TurnDuration{0.5};
+		static constexpr auto TurnRate{UE_HALF_PI / TurnDuration};
+		static constexpr auto StopStartTime{3.2};
+
+		double Speed;
+		double TangentialAcceleration;
+
+		if (Time < MaxSpeed / MaxAcceleration)
+		{
+			Speed = MaxAcceleration * Time;
+			TangentialAcceleration = MaxAcceleration;
+		}
+		else if (Time < StopStartTime)
+		{
+			Speed = MaxSpeed;
+			TangentialAcceleration = 0.0;
+		}
+		else if (Time < StopStartTime + MaxSpeed / MaxAcceleration)
+		{
+			Speed = MaxSpeed - MaxAcceleration * (Time - StopStartTime);
+			TangentialAcceleration = -MaxAcceleration;
+		}
+		else
+		{
+			Speed = 0.0;
+			TangentialAcceleration = 0.0;
+		}
+
+		const auto bTurning{Time >= TurnStartTime && Time < TurnStartTime + TurnDuration};
+		const auto Angle{bTurning ? TurnRate * (Time - TurnStartTime) : Time >= TurnStartTime ? UE_HALF_PI : 0.0};
+
+		const FVector Direction{FMath::Cos(Angle), FMath::Sin(Angle), 0.0};
+
+		Velocity = Direction * Speed;
+		Acceleration = Direction * TangentialAcceleration;
+
+		if (bTurning)
+		{
+			Acceleration += FVector{-Direction.Y, Direction.X, 0.0} * Speed * TurnRate;
+		}
+	}
+
+	static void GetAcceleratingVelocity(const double Time, FVector& Velocity, FVector& Acceleration)
+	{
+		Acceleration = {500.0, 0.0, 0.0};
+		Velocity = Acceleration * Time;
+	}
+
+	struct FSimulationResult
+	{
+		double SmoothedVelocityError{0.0};
+
+		double HeldVelocityError{0.0};
+
+		double SmoothedAccelerationError{0.0};
+
+		double HeldAccelerationError{0.0};
+
+		double SmoothedMaxVelocityChange{0.0};
+
+		double HeldMaxVelocityChange{0.0};
+
+		FVector FinalSmoothedVelocity{ForceInit};
+	};
+
+	// Simulates a simulated proxy that receives the velocity every update interval, and compares the smoothed velocity and
+	// acceleration, and the latest received velocity and its rate of change, with the full rate reference in every frame.
+
+	template <typename ReferenceFunctionType>
+	static FSimulationResult Simulate(const ReferenceFunctionType& GetReference, const float UpdateInterval,
+	                                  const float Duration, const float ErrorStartTime = 0.0f)
+	{
+		FAlsVelocityNetworkSmoothingState Smoothing;
+		Smoothing.bEnabled = true;
+
+		FVector HeldVelocity{ForceInit};
+		FVector PreviousSmoothedVelocity{ForceInit};
+		FVector PreviousHeldVelocity{ForceInit};
+
+		FSimulationResult Result;
+
+		auto NextUpdateTime{UpdateInterval};
+		auto ErrorFramesCount{0};
+
+		const auto FramesCount{FMath::RoundToInt(Duration / FrameDeltaTime)};
+
+		for (auto Frame{1}; Frame <= FramesCount; Frame++)
+		{
+			const auto Time{Frame * FrameDeltaTime};
+
+			FVector ReferenceVelocity;
+			FVector ReferenceAcceleration;
+
+			if (Time >= NextUpdateTime - UE_KINDA_SMALL_NUMBER)
+			{
+				GetReference(NextUpdateTime, ReferenceVelocity, ReferenceAcceleration);
+
+				Smoothing.Correct(NextUpdateTime, ReferenceVelocity, FVector::ZeroVector,
+				                  MaxServerDeltaTime, MaxExtrapolationTime, MaxSpeed);
+
+				HeldVelocity = ReferenceVelocity;
+				NextUpdateTime += UpdateInterval;
+			}
+
+			Smoothing.Refresh(FrameDeltaTime, MaxExtrapolationTime, MaxSpeed);
+
+			GetReference(Time, ReferenceVelocity, ReferenceAcceleration);
+
+			if (Time >= ErrorStartTime)
+			{
+				Result.SmoothedVelocityError += FVector::Dist(Smoothing.CurrentVelocity, ReferenceVelocity);
+				Result.HeldVelocityError += FVector::Dist(HeldVelocity, ReferenceVelocity);
+
+				Result.SmoothedAccelerationError += FVector::Dist(Smoothing.CurrentAcceleration, ReferenceAcceleration);
+				Result.HeldAccelerationError += FVector::Dist((HeldVelocity - PreviousHeldVelocity) / FrameDeltaTime,
+				                                              ReferenceAcceleration);
+
+				Result.SmoothedMaxVelocityChange = FMath::Max(Result.SmoothedMaxVelocityChange,
+				                                              FVector::Dist(Smoothing.CurrentVelocity, PreviousSmoothedVelocity));
+
+				Result.HeldMaxVelocityChange = FMath::Max(Result.HeldMaxVelocityChange,
+				                                          FVector::Dist(HeldVelocity, PreviousHeldVelocity));
+
+				ErrorFramesCount += 1;
+			}
+
+			PreviousSmoothedVelocity = Smoothing.CurrentVelocity;
+			PreviousHeldVelocity = HeldVelocity;
+		}
+
+		Result.SmoothedVelocityError /= ErrorFramesCount;
+		Result.HeldVelocityError /= ErrorFramesCount;
+		Result.SmoothedAccelerationError /= ErrorFramesCount;
+		Result.HeldAccelerationError /= ErrorFramesCount;
+		Result.FinalSmoothedVelocity = Smoothing.CurrentVelocity;
+
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsVelocityNetworkSmoothingErrorTest, "Als.Character.VelocityNetworkSmoothing.Error",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsVelocityNetworkSmoothingErrorTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsVelocityNetworkSmoothingTests;
+
+	for (const auto UpdateInterval : {0.1f, 0.2f})
+	{
+		const auto Result{Simulate(&GetRunningVelocity, UpdateInterval, 4.0f)};
+
+		AddInfo(FString::Printf(TEXT("Update interval %.1f s: mean velocity error %.2f cm/s (%.2f cm/s without smoothing), ")
+		                        TEXT("mean acceleration error %.2f cm/s^2 (%.2f cm/s^2 without smoothing)."),
+		                        UpdateInterval, Result.SmoothedVelocityError, Result.HeldVelocityError,
+		                        Result.SmoothedAccelerationError, Result.HeldAccelerationError));
+
+		// The smoothing must not follow the server worse than the latest received velocity, while changing much less per frame.
+
+		TestTrue(FString::Printf(TEXT("Update interval %.1f s: velocity error is lower than without smoothing"), UpdateInterval),
+		         Result.SmoothedVelocityError < Result.HeldVelocityError);
+
+		TestTrue(FString::Printf(TEXT("Update interval %.1f s: acceleration error is lower than without smoothing"), UpdateInterval),
+		         Result.SmoothedAccelerationError < Result.HeldAccelerationError * 0.75);
+
+		TestTrue(FString::Printf(TEXT("Update interval %.1f s: velocity changes smoothly"), UpdateInterval),
+		         Result.SmoothedMaxVelocityChange <= Result.HeldMaxVelocityChange * 0.5);
+
+		// The extrapolation must not reverse the movement direction when the character stops.
+
+		TestTrue(FString::Printf(TEXT("Update interval %.1f s: character stops"), UpdateInterval),
+		         Result.FinalSmoothedVelocity.IsNearlyZero(UE_KINDA_SMALL_NUMBER));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsVelocityNetworkSmoothingConstantAccelerationTest,
+                                 "Als.Character.VelocityNetworkSmoothing.ConstantAcceleration",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsVelocityNetworkSmoothingConstantAccelerationTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsVelocityNetworkSmoothingTests;
+
+	// Once the acceleration is estimated from the first two updates, the extrapolation follows the server velocity,
+	// apart from the one frame lead caused by refreshing the smoothing after the update is received.
+
+	const auto Result{Simulate(&GetAcceleratingVelocity, 0.2f, 1.0f, 0.5f)};
+
+	AddInfo(FString::Printf(TEXT("Mean velocity error %.2f cm/s (%.2f cm/s without smoothing)."),
+	                        Result.SmoothedVelocityError, Result.HeldVelocityError));
+
+	TestTrue(TEXT("Velocity error is much lower than without smoothing"), Result.SmoothedVelocityError < Result.HeldVelocityError * 0.25);
+	TestTrue(TEXT("Acceleration is extrapolated"), Result.SmoothedAccelerationError < 1.0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsVelocityNetworkSmoothingInputDirectionTest, "Als.Character.VelocityNetworkSmoothing.InputDirection",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsVelocityNetworkSmoothingInputDirectionTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsVelocityNetworkSmoothingTests;
+
+	FAlsVelocityNetworkSmoothingState Smoothing;
+	Smoothing.bEnabled = true;
+	Smoothing.Snap(1.0f, FVector::ZeroVector, FVector::ZeroVector);
+
+	Smoothing.Correct(1.2f, FVector::ZeroVector, FVector::XAxisVector, MaxServerDeltaTime, MaxExtrapolationTime, MaxSpeed);
+
+	// The input direction is blended over half of the time between the updates.
+
+	Smoothing.Refresh(0.05f, MaxExtrapolationTime, MaxSpeed);
+
+	TestEqual(TEXT("Input direction is blended"), Smoothing.CurrentInputDirection, FVector{0.5, 0.0, 0.0}, UE_KINDA_SMALL_NUMBER);
+
+	Smoothing.Refresh(0.05f, MaxExtrapolationTime, MaxSpeed);
+
+	TestEqual(TEXT("Input direction reaches the server one"), Smoothing.CurrentInputDirection, FVector::XAxisVector, UE_KINDA_SMALL_NUMBER);
+
+	// Updates after a long pause can't be blended over the time between them.
+
+	Smoothing.Correct(10.0f, FVector{100.0, 0.0, 0.0}, FVector::YAxisVector, MaxServerDeltaTime, MaxExtrapolationTime, MaxSpeed);
+
+	TestEqual(TEXT("Velocity is snapped after a long pause"), Smoothing.CurrentVelocity, FVector{100.0, 0.0, 0.0}, UE_KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Input direction is snapped after a long pause"),
+	          Smoothing.CurrentInputDirection, FVector::YAxisVector, UE_KINDA_SMALL_NUMBER);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsVelocityNetworkSmoothingInputReversalTest, "Als.Character.VelocityNetworkSmoothing.InputReversal",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsVelocityNetworkSmoothingInputReversalTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsVelocityNetworkSmoothingTests;
+
+	FAlsVelocityNetworkSmoothingState Smoothing;
+	Smoothing.bEnabled = true;
+	Smoothing.Snap(1.0f, FVector::ZeroVector, FVector::XAxisVector);
+
+	Smoothing.Correct(1.2f, FVector::ZeroVector, -FVector::XAxisVector, MaxServerDeltaTime, MaxExtrapolationTime, MaxSpeed);
+
+	// A reversed input must be blended around the circle instead of through zero, otherwise the character would lose its input.
+
+	auto MinInputLength{1.0f};
+
+	for (auto i{0}; i < 10; i++)
+	{
+		Smoothing.Refresh(0.01f, MaxExtrapolationTime, MaxSpeed);
+		MinInputLength = FMath::Min(MinInputLength, UE_REAL_TO_FLOAT(Smoothing.CurrentInputDirection.Size()));
+	}
+
+	TestEqual(TEXT("Input direction keeps its length while reversed"), MinInputLength, 1.0f, UE_KINDA_SMALL_NUMBER);
+
+	TestEqual(TEXT("Input direction reaches the reversed one"),
+	          Smoothing.CurrentInputDirection, -FVector::XAxisVector, UE_KINDA_SMALL_NUMBER);
+
+	return true;
+}
+
+#endif
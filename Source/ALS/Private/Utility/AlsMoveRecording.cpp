@@ -0,0 +1,76 @@
+#include "Utility/AlsMoveRecording.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsMoveRecording)
+
+namespace AlsMoveRecording
+{
+	static void SerializeTag(FArchive& Archive, FGameplayTag& Tag)
+	{
+		auto TagName{Tag.GetTagName()};
+		Archive << TagName;
+
+		if (Archive.IsLoading())
+		{
+			Tag = FGameplayTag::RequestGameplayTag(TagName, false);
+		}
+	}
+
+	static void SerializeFlags(FArchive& Archive, FAlsRecordedMove& Move)
+	{
+		uint8 Flags{0};
+
+		if (Archive.IsSaving())
+		{
+			Flags = (Move.bStartCrouched ? 1 << 0 : 0) |
+			        (Move.bStartProned ? 1 << 1 : 0) |
+			        (Move.bStartWantsToCrouch ? 1 << 2 : 0) |
+			        (Move.bStartWantsToProne ? 1 << 3 : 0) |
+			        (Move.bStartPrevWantsToCrouch ? 1 << 4 : 0);
+		}
+
+		Archive << Flags;
+
+		if (Archive.IsLoading())
+		{
+			Move.bStartCrouched = (Flags & 1 << 0) != 0;
+			Move.bStartProned = (Flags & 1 << 1) != 0;
+			Move.bStartWantsToCrouch = (Flags & 1 << 2) != 0;
+			Move.bStartWantsToProne = (Flags & 1 << 3) != 0;
+			Move.bStartPrevWantsToCrouch = (Flags & 1 << 4) != 0;
+		}
+	}
+}
+
+void FAlsRecordedMove::Serialize(FArchive& Archive)
+{
+	Archive << TimeStamp;
+	Archive << DeltaTime;
+	Archive << CompressedFlags;
+	Archive << StartMovementMode;
+	Archive << StartCustomMovementMode;
+	Archive << Acceleration;
+
+	AlsMoveRecording::SerializeTag(Archive, RotationMode);
+	AlsMoveRecording::SerializeTag(Archive, Stance);
+	AlsMoveRecording::SerializeTag(Archive, MaxAllowedGait);
+
+	Archive << StartLocation;
+	Archive << StartRotation;
+	Archive << StartVelocity;
+	Archive << StartCapsuleHalfHeight;
+
+	AlsMoveRecording::SerializeFlags(Archive, *this);
+
+	Archive << EndLocation;
+	Archive << EndVelocity;
+}
+
+void FAlsRecordedMove::Save(FArchive& Archive) const
+{
+	check(Archive.IsSaving())
+
+	// Serialize() doesn't modify the move while saving, but it can't be const, since it is also used for loading.
+
+	auto Move{*this};
+	Move.Serialize(Archive);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Engine/ScopedMovementUpdate.h"
+
+class USkeletalMeshComponent;
+
+// Defers the mesh transform updates while the saved moves are replayed after a server correction,
+// so that the mesh and its attached components are updated only once after the last replayed move.
+// Can be disabled with the als.Movement.DeferMeshMovementDuringReplay console variable.
+struct FAlsScopedMeshMovementUpdate
+{
+	explicit FAlsScopedMeshMovementUpdate(USkeletalMeshComponent* Mesh, const bool bEnabled = true)
+		: ScopedMoveUpdate{bEnabled && CanDefer(Mesh) ? Mesh : nullptr, EScopedUpdate::DeferredUpdates} {}
+
+	static bool CanDefer(const USkeletalMeshComponent* Mesh);
+
+private:
+	FScopedMovementUpdate ScopedMoveUpdate;
+};
@@ -0,0 +1,125 @@
+#include "Utility/AlsSkeletalMeshData.h"
+
+#include "Engine/SkinnedAsset.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/ObjectKey.h"
+#include "Utility/AlsConstants.h"
+
+namespace AlsSkeletalMeshData
+{
+	static FRWLock Lock;
+
+	static TMap<TObjectKey<USkinnedAsset>, TSharedRef<const FAlsSkeletalMeshData>> Cache;
+
+	static FAutoConsoleCommand ConsoleCommandReset{
+		TEXT("als.SkeletalMeshData.Reset"),
+		TEXT("Discards the skeletal mesh data shared by ALS animation instances. It will be rebuilt on the next request."),
+		FConsoleCommandDelegate::CreateStatic(&FAlsSkeletalMeshData::Reset)
+	};
+
+	static FVector3f GetThighAxis(const FReferenceSkeleton& ReferenceSkeleton, const int32 PelvisBoneIndex,
+	                              const FName& FootBoneName, const FVector3f& DefaultThighAxis)
+	{
+		auto ParentBoneIndex{ReferenceSkeleton.FindBoneIndex(FootBoneName)};
+		if (ParentBoneIndex < 0)
+		{
+			return DefaultThighAxis;
+		}
+
+		while (true)
+		{
+			const auto NextParentBoneIndex{ReferenceSkeleton.GetParentIndex(ParentBoneIndex)};
+			if (NextParentBoneIndex <= 0)
+			{
+				return DefaultThighAxis;
+			}
+
+			if (NextParentBoneIndex == PelvisBoneIndex)
+			{
+				break;
+			}
+
+			ParentBoneIndex = NextParentBoneIndex;
+		}
+
+		const auto& ThighTransform{ReferenceSkeleton.GetRefBonePose()[ParentBoneIndex]};
+
+		FVector3f ThighAxis{ThighTransform.GetLocation()};
+		ThighAxis.Normalize();
+
+		return ThighAxis;
+	}
+}
+
+TSharedRef<const FAlsSkeletalMeshData> FAlsSkeletalMeshData::Get(const USkinnedAsset& SkinnedAsset)
+{
+	const TObjectKey<USkinnedAsset> Key{&SkinnedAsset};
+
+	{
+		FReadScopeLock ReadLock{AlsSkeletalMeshData::Lock};
+
+		const auto* Data{AlsSkeletalMeshData::Cache.Find(Key)};
+
+#if WITH_EDITOR
+		if (Data != nullptr && (*Data)->BonesCount == SkinnedAsset.GetRefSkeleton().GetNum())
+#else
+		if (Data != nullptr)
+#endif
+		{
+			return *Data;
+		}
+	}
+
+	auto NewData{Build(SkinnedAsset)};
+
+	FWriteScopeLock WriteLock{AlsSkeletalMeshData::Lock};
+
+	// Also remove the data of skinned assets that no longer exist.
+
+	for (auto Iterator{AlsSkeletalMeshData::Cache.CreateIterator()}; Iterator; ++Iterator)
+	{
+		if (Iterator->Key.ResolveObjectPtr() == nullptr)
+		{
+			Iterator.RemoveCurrent();
+		}
+	}
+
+	AlsSkeletalMeshData::Cache.Add(Key, NewData);
+
+	return NewData;
+}
+
+void FAlsSkeletalMeshData::Reset()
+{
+	FWriteScopeLock WriteLock{AlsSkeletalMeshData::Lock};
+
+	AlsSkeletalMeshData::Cache.Reset();
+}
+
+TSharedRef<const FAlsSkeletalMeshData> FAlsSkeletalMeshData::Build(const USkinnedAsset& SkinnedAsset)
+{
+	const auto& ReferenceSkeleton{SkinnedAsset.GetRefSkeleton()};
+
+	auto Data{MakeShared<FAlsSkeletalMeshData>()};
+
+	Data->PelvisBoneIndex = ReferenceSkeleton.FindBoneIndex(UAlsConstants::PelvisBoneName());
+
+	Data->FootLeftIkBoneIndex = ReferenceSkeleton.FindBoneIndex(UAlsConstants::FootLeftIkBoneName());
+	Data->FootRightIkBoneIndex = ReferenceSkeleton.FindBoneIndex(UAlsConstants::FootRightIkBoneName());
+
+	Data->FootLeftVirtualBoneIndex = ReferenceSkeleton.FindBoneIndex(UAlsConstants::FootLeftVirtualBoneName());
+	Data->FootRightVirtualBoneIndex = ReferenceSkeleton.FindBoneIndex(UAlsConstants::FootRightVirtualBoneName());
+
+	Data->ThighLeftAxis = AlsSkeletalMeshData::GetThighAxis(ReferenceSkeleton, Data->PelvisBoneIndex,
+	                                                        UAlsConstants::FootLeftBoneName(), Data->ThighLeftAxis);
+
+	Data->ThighRightAxis = AlsSkeletalMeshData::GetThighAxis(ReferenceSkeleton, Data->PelvisBoneIndex,
+	                                                         UAlsConstants::FootRightBoneName(), Data->ThighRightAxis);
+
+#if WITH_EDITOR
+	Data->BonesCount = ReferenceSkeleton.GetNum();
+#endif
+
+	return Data;
+}
@@ -0,0 +1,58 @@
+#include "Utility/AlsStats.h"
+
+CSV_DEFINE_CATEGORY_MODULE(ALS_API, AlsCharacter, false);
+CSV_DEFINE_CATEGORY_MODULE(ALS_API, AlsMovement, false);
+CSV_DEFINE_CATEGORY_MODULE(ALS_API, AlsCamera, false);
+CSV_DEFINE_CATEGORY_MODULE(ALS_API, AlsSceneQueries, false);
+CSV_DEFINE_CATEGORY_MODULE(ALS_API, AlsNetwork, false);
+
+DEFINE_STAT(STAT_Als_MantlingSceneQueries);
+DEFINE_STAT(STAT_Als_FootIkSceneQueries);
+DEFINE_STAT(STAT_Als_GroundPredictionSceneQueries);
+DEFINE_STAT(STAT_Als_CameraSceneQueries);
+DEFINE_STAT(STAT_Als_FootstepSceneQueries);
+DEFINE_STAT(STAT_Als_SlideSceneQueries);
+DEFINE_STAT(STAT_Als_ProneSceneQueries);
+DEFINE_STAT(STAT_Als_RagdollingSceneQueries);
+
+DEFINE_STAT(STAT_AlsCharacterMovementClientUpdatePositionAfterServerUpdate);
+
+DEFINE_STAT(STAT_Als_StanceExitAttempts);
+DEFINE_STAT(STAT_Als_StanceExitAttemptsSkipped);
+
+DEFINE_STAT(STAT_Als_MeshRotationSyncsSkipped);
+DEFINE_STAT(STAT_Als_MeshRotationSyncsLightweight);
+DEFINE_STAT(STAT_Als_MeshRotationSyncsFull);
+
+DEFINE_STAT(STAT_Als_ServerRpcsReceived);
+DEFINE_STAT(STAT_Als_ClientRpcsReceived);
+DEFINE_STAT(STAT_Als_MulticastRpcsSent);
+DEFINE_STAT(STAT_Als_ServerMovementCorrections);
+DEFINE_STAT(STAT_Als_ClientMovementCorrections);
+
+#if !UE_BUILD_SHIPPING
+bool FAlsNetworkEventCounters::bEnabled{false};
+
+TMap<FName, int64> FAlsNetworkEventCounters::Counts;
+
+void FAlsNetworkEventCounters::SetEnabled(const bool bNewEnabled)
+{
+	check(IsInGameThread())
+
+	bEnabled = bNewEnabled;
+}
+
+void FAlsNetworkEventCounters::Increment(const FName& EventName)
+{
+	check(IsInGameThread())
+
+	Counts.FindOrAdd(EventName) += 1;
+}
+
+void FAlsNetworkEventCounters::Reset()
+{
+	check(IsInGameThread())
+
+	Counts.Reset();
+}
+#endif
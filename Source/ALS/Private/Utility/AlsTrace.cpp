@@ -0,0 +1,154 @@
+#include "Utility/AlsTrace.h"
+
+#if ALS_TRACE_ENABLED
+
+#include "AlsAnimationInstance.h"
+#include "AlsCharacter.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+UE_TRACE_CHANNEL_DEFINE(AlsChannel)
+
+// Gameplay tags are sent only once per session, then states reference them by identifier. The event
+// is important, so that names are also received by analyzers that connect after they have been sent.
+
+UE_TRACE_EVENT_BEGIN(Als, GameplayTag, NoSync | Important)
+	UE_TRACE_EVENT_FIELD(uint32, Id)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Als, CharacterState)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(double, RecordingTime)
+	UE_TRACE_EVENT_FIELD(uint64, CharacterId)
+	UE_TRACE_EVENT_FIELD(uint32, LocomotionMode)
+	UE_TRACE_EVENT_FIELD(uint32, Stance)
+	UE_TRACE_EVENT_FIELD(uint32, Gait)
+	UE_TRACE_EVENT_FIELD(uint32, RotationMode)
+	UE_TRACE_EVENT_FIELD(uint32, LocomotionAction)
+	UE_TRACE_EVENT_FIELD(uint32, OverlayMode)
+	UE_TRACE_EVENT_FIELD(float, Speed)
+	UE_TRACE_EVENT_FIELD(int32, FloorQueriesCount)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Als, AnimationState)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(double, RecordingTime)
+	UE_TRACE_EVENT_FIELD(uint64, CharacterId)
+	UE_TRACE_EVENT_FIELD(float[], LayeringCurves)
+	UE_TRACE_EVENT_FIELD(float, FootLeftLockAmount)
+	UE_TRACE_EVENT_FIELD(float, FootRightLockAmount)
+	UE_TRACE_EVENT_FIELD(float, FootPlantedAmount)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Als, SceneQueries)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, CharacterId)
+	UE_TRACE_EVENT_FIELD(uint8, Subsystem)
+	UE_TRACE_EVENT_FIELD(int32, Count)
+UE_TRACE_EVENT_END()
+
+namespace AlsTrace
+{
+	static FCriticalSection TracedNamesLock;
+
+	static TSet<uint32> TracedNames;
+
+	static uint32 OutputGameplayTag(const FGameplayTag& Tag)
+	{
+		const auto Id{Tag.GetTagName().GetComparisonIndex().ToUnstableInt()};
+
+		FScopeLock Lock{&TracedNamesLock};
+
+		auto bAlreadyTraced{false};
+		TracedNames.Add(Id, &bAlreadyTraced);
+
+		if (!bAlreadyTraced)
+		{
+			const auto TagName{Tag.ToString()};
+
+			UE_TRACE_LOG(Als, GameplayTag, AlsChannel)
+				<< GameplayTag.Id(Id)
+				<< GameplayTag.Name(*TagName, TagName.Len());
+		}
+
+		return Id;
+	}
+}
+
+void FAlsTrace::OutputCharacterState(const AAlsCharacter& Character, const int32 FloorQueriesCount)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(AlsChannel) || CANNOT_TRACE_OBJECT(&Character))
+	{
+		return;
+	}
+
+	TRACE_OBJECT(&Character);
+
+	const auto LocomotionMode{AlsTrace::OutputGameplayTag(Character.GetLocomotionMode())};
+	const auto Stance{AlsTrace::OutputGameplayTag(Character.GetStance())};
+	const auto Gait{AlsTrace::OutputGameplayTag(Character.GetGait())};
+	const auto RotationMode{AlsTrace::OutputGameplayTag(Character.GetRotationMode())};
+	const auto LocomotionAction{AlsTrace::OutputGameplayTag(Character.GetLocomotionAction())};
+	const auto OverlayMode{AlsTrace::OutputGameplayTag(Character.GetOverlayMode())};
+
+	UE_TRACE_LOG(Als, CharacterState, AlsChannel)
+		<< CharacterState.Cycle(FPlatformTime::Cycles64())
+		<< CharacterState.RecordingTime(FObjectTrace::GetWorldElapsedTime(Character.GetWorld()))
+		<< CharacterState.CharacterId(FObjectTrace::GetObjectId(&Character))
+		<< CharacterState.LocomotionMode(LocomotionMode)
+		<< CharacterState.Stance(Stance)
+		<< CharacterState.Gait(Gait)
+		<< CharacterState.RotationMode(RotationMode)
+		<< CharacterState.LocomotionAction(LocomotionAction)
+		<< CharacterState.OverlayMode(OverlayMode)
+		<< CharacterState.Speed(Character.GetLocomotionState().Speed)
+		<< CharacterState.FloorQueriesCount(FloorQueriesCount);
+}
+
+void FAlsTrace::OutputAnimationState(const UAlsAnimationInstance& AnimationInstance, const AAlsCharacter& Character,
+                                     const FAlsLayeringState& LayeringState, const FAlsFeetState& FeetState)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(AlsChannel) || CANNOT_TRACE_OBJECT(&Character))
+	{
+		return;
+	}
+
+	// Layering curves are sent in the order of the layering state properties, so
+	// that the analyzer can restore their names using the same reflection data.
+
+	TArray<float, TInlineAllocator<32>> LayeringCurves;
+
+	for (TFieldIterator<FFloatProperty> Iterator{FAlsLayeringState::StaticStruct()}; Iterator; ++Iterator)
+	{
+		LayeringCurves.Add(Iterator->GetPropertyValue_InContainer(&LayeringState));
+	}
+
+	UE_TRACE_LOG(Als, AnimationState, AlsChannel)
+		<< AnimationState.Cycle(FPlatformTime::Cycles64())
+		<< AnimationState.RecordingTime(FObjectTrace::GetWorldElapsedTime(AnimationInstance.GetWorld()))
+		<< AnimationState.CharacterId(FObjectTrace::GetObjectId(&Character))
+		<< AnimationState.LayeringCurves(LayeringCurves.GetData(), LayeringCurves.Num())
+		<< AnimationState.FootLeftLockAmount(FeetState.Left.LockAmount)
+		<< AnimationState.FootRightLockAmount(FeetState.Right.LockAmount)
+		<< AnimationState.FootPlantedAmount(FeetState.FootPlantedAmount);
+}
+
+void FAlsTrace::OutputSceneQueries(const AActor* Actor, const EAlsTraceSceneQuerySubsystem Subsystem, const int32 Count)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(AlsChannel) || Actor == nullptr || CANNOT_TRACE_OBJECT(Actor))
+	{
+		return;
+	}
+
+	// Queries are sent as separate events and are summed per character frame by the analyzer, so that
+	// queries performed outside of the character tick, such as the camera and foot IK ones, are also included.
+
+	UE_TRACE_LOG(Als, SceneQueries, AlsChannel)
+		<< SceneQueries.Cycle(FPlatformTime::Cycles64())
+		<< SceneQueries.CharacterId(FObjectTrace::GetObjectId(Actor))
+		<< SceneQueries.Subsystem(static_cast<uint8>(Subsystem))
+		<< SceneQueries.Count(Count);
+}
+
+#endif
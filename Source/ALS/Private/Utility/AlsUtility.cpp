@@ -72,3 +72,34 @@ bool UAlsUtility::TryGetMovementBaseRotationSpeed(const FBasedMovementInfo& Base
 
 	return true;
 }
+
+bool UAlsUtility::TryGetComponentSpaceBoneTransform(const USkinnedMeshComponent& Mesh, int32 BoneIndex, FTransform& Transform)
+{
+	check(IsInGameThread())
+
+	const auto* PoseMesh{&Mesh};
+	const auto* LeaderPoseComponent{Mesh.LeaderPoseComponent.Get()};
+
+	if (IsValid(LeaderPoseComponent))
+	{
+		// Follower meshes don't evaluate their own pose, so their component space transforms are empty.
+
+		const auto& LeaderBoneMap{Mesh.GetLeaderBoneMap()};
+		if (!LeaderBoneMap.IsValidIndex(BoneIndex))
+		{
+			return false;
+		}
+
+		PoseMesh = LeaderPoseComponent;
+		BoneIndex = LeaderBoneMap[BoneIndex];
+	}
+
+	const auto& ComponentSpaceTransforms{PoseMesh->GetComponentSpaceTransforms()};
+	if (!ComponentSpaceTransforms.IsValidIndex(BoneIndex))
+	{
+		return false;
+	}
+
+	Transform = ComponentSpaceTransforms[BoneIndex];
+	return true;
+}
@@ -24,6 +24,7 @@
 #include "Utility/AlsGameplayTags.h"
 #include "AlsAnimationInstance.generated.h"
 
+struct FAlsSkeletalMeshData;
 class UAlsLinkedAnimationInstance;
 class AAlsCharacter;
 
@@ -120,9 +121,21 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsInAirState InAirState;
 
+	FAlsBallisticGroundPredictionState BallisticGroundPrediction;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsFeetState FeetState;
 
+	// Bone indices and other data derived from the skeletal mesh, shared with all other animation instances
+	// using the same mesh. Allows reading the feet targets from the mesh pose without name lookups.
+	TSharedPtr<const FAlsSkeletalMeshData> SkeletalMeshData;
+
+	// Component space transforms of the feet targets, copied from the mesh pose on the game thread, since
+	// the mesh pose buffers are not safe to read on a worker thread while the mesh may be reallocating them.
+	FTransform FootLeftTargetComponentTransform;
+
+	FTransform FootRightTargetComponentTransform;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsTransitionsState TransitionsState;
 
@@ -166,7 +179,13 @@ public:
 
 	void MarkTeleported();
 
+	// Stops all montages and resets the animation state and the animation graph nodes to the state of a newly
+	// initialized animation instance. Unlike re-initialization, this doesn't call NativeInitializeAnimation().
+	void ResetState();
+
 private:
+	void RefreshMeshRotationOnGameThread() const;
+
 	void RefreshMovementBaseOnGameThread();
 
 	void RefreshLayering();
@@ -267,6 +286,10 @@ public:
 private:
 	void RefreshInAirOnGameThread();
 
+	void RefreshBallisticGroundPredictionOnGameThread();
+
+	void StartBallisticGroundPrediction();
+
 protected:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Animation Instance", Meta = (BlueprintThreadSafe))
 	void RefreshInAir();
@@ -280,6 +303,8 @@ protected:
 private:
 	void RefreshFeetOnGameThread();
 
+	void RefreshFeetTargets(const FTransform& ComponentTransform);
+
 	void RefreshFeet(float DeltaTime);
 
 	void ProcessFootLockTeleport(const FAlsFootUpdateContext& Context) const;
@@ -13,6 +13,10 @@ public:
 
 	explicit FAlsAnimationInstanceProxy(UAnimInstance* AnimationInstance);
 
+	// Re-initializes the nodes of the animation graph, including the linked graphs, so that state machines return to
+	// their entry states and active inertializations are discarded, without re-initializing the animation instance itself.
+	void ResetGraph();
+
 protected:
 	virtual void PostUpdate(UAnimInstance* AnimationInstance) const override;
 };
@@ -4,6 +4,8 @@
 #include "State/AlsLocomotionState.h"
 #include "State/AlsMantlingState.h"
 #include "State/AlsMovementBaseState.h"
+#include "State/AlsPoseHistory.h"
+#include "State/AlsRagdollPose.h"
 #include "State/AlsRagdollingState.h"
 #include "State/AlsRollingState.h"
 #include "State/AlsViewState.h"
@@ -12,6 +14,7 @@
 #include "AlsCharacter.generated.h"
 
 struct FAlsMantlingParameters;
+struct FStreamableHandle;
 struct FAlsMantlingTraceSettings;
 class UAlsCharacterMovementComponent;
 class UAlsCharacterSettings;
@@ -87,6 +90,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsViewState ViewState;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
+	FAlsVelocityNetworkSmoothingState VelocityNetworkSmoothing;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, Replicated)
 	FVector_NetQuantizeNormal InputDirection{ForceInit};
 
@@ -106,14 +112,42 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, Replicated)
 	FVector_NetQuantize RagdollTargetLocation{ForceInit};
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
+		ReplicatedUsing = "OnReplicated_RagdollPose")
+	FAlsRagdollPose RagdollPose;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsRagdollingState RagdollingState;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsRollingState RollingState;
 
+	UPROPERTY(VisibleAnywhere, Category = "State|Als Character", Transient)
+	TSubclassOf<UAnimInstance> LinkedOverlayLayerClass;
+
+	// Recently linked overlay layer classes, the most recently linked one is the last.
+	UPROPERTY(VisibleAnywhere, Category = "State|Als Character", Transient)
+	TArray<TSubclassOf<UAnimInstance>> CachedOverlayLayerClasses;
+
+	TMap<FGameplayTag, TSharedPtr<FStreamableHandle>> OverlayLayerPreloadHandles;
+
+	TSharedPtr<FStreamableHandle> OverlayLayerLoadHandle;
+
+	// Recorded only on the server and only if enabled in the character settings.
+	FAlsPoseHistory PoseHistory;
+
+	FDelegateHandle PoseHistoryRecordingHandle;
+
 	FTimerHandle BrakingFrictionFactorResetTimer;
 
+	// Time accumulated for the fixed rate logic, see UAlsCharacterSettings::DedicatedServerFixedLogicRate.
+	UPROPERTY(VisibleAnywhere, Category = "State|Als Character", Transient, Meta = (ForceUnits = "s"))
+	float FixedLogicAccumulatedTime{0.0f};
+
+	// Incremented each time the character is reset for reuse, so that clients reset their local state too.
+	UPROPERTY(VisibleAnywhere, Category = "State|Als Character", Transient, ReplicatedUsing = "OnReplicated_ReuseCount")
+	uint8 ReuseCount{0};
+
 public:
 	explicit AAlsCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
@@ -132,6 +166,8 @@ public:
 protected:
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void CalcCamera(float DeltaTime, FMinimalViewInfo& ViewInfo) override;
 
 	virtual bool CanJumpInternal_Implementation() const override;
@@ -139,6 +175,8 @@ protected:
 public:
 	virtual void PostNetReceiveLocationAndRotation() override;
 
+	virtual void PostNetReceiveVelocity(const FVector& NewVelocity) override;
+
 	virtual void OnRep_ReplicatedBasedMovement() override;
 
 	virtual void OnRep_IsCrouched() override;
@@ -157,11 +195,26 @@ public:
 public:
 	const UAlsCharacterSettings* GetSettings() const;
 
+	// Stops all actions and resets the character to the state it had after it began play, so that it can be reused
+	// instead of spawning a new character. Used by UAlsCharacterPoolSubsystem, should only be called on the server,
+	// clients reset their local state when they receive the incremented reuse count.
+	virtual void ResetForReuse();
+
+private:
+	// Resets the state that is not replicated, and which each machine therefore has to reset on its own.
+	void ResetLocalStateForReuse();
+
+	UFUNCTION()
+	void OnReplicated_ReuseCount();
+
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character", Meta = (ReturnDisplayName = "Handled"))
 	bool OnCalculateCamera(float DeltaTime, FMinimalViewInfo& ViewInfo);
 
 private:
+	// Returns the number of fixed rate logic steps to run in this frame and their delta time.
+	int32 ConsumeFixedLogicSteps(float DeltaTime, float& StepDeltaTime);
+
 	void RefreshMeshProperties() const;
 
 	void RefreshMovementBase();
@@ -342,6 +395,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Character", Meta = (AutoCreateRefTerm = "NewOverlayMode"))
 	void SetOverlayMode(const FGameplayTag& NewOverlayMode);
 
+	// Starts loading the layer class of the overlay mode in the background, so that it can be linked without a hitch
+	// when that overlay mode is set. Call this as soon as it is known that the overlay mode will be set soon, for
+	// example when the character starts picking up a weapon. The layer class stays loaded during the character's lifetime.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character", Meta = (AutoCreateRefTerm = "OverlayModeToPreload"))
+	void PreloadOverlayLayer(const FGameplayTag& OverlayModeToPreload);
+
 private:
 	void SetOverlayMode(const FGameplayTag& NewOverlayMode, bool bSendRpc);
 
@@ -354,6 +413,10 @@ private:
 	UFUNCTION()
 	void OnReplicated_OverlayMode(const FGameplayTag& PreviousOverlayMode);
 
+	void RefreshOverlayLayer();
+
+	void LinkOverlayLayer(TSubclassOf<UAnimInstance> NewLayerClass);
+
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character")
 	void OnOverlayModeChanged(const FGameplayTag& PreviousOverlayMode);
@@ -404,7 +467,9 @@ public:
 	const FRotator& GetReplicatedViewRotation() const;
 
 private:
-	void RefreshView(float DeltaTime);
+	// The network smoothing delta time is zero in frames without fixed rate logic steps,
+	// in which case the network smoothing only keeps its rotations relative to the movement base.
+	void RefreshView(float DeltaTime, float NetworkSmoothingDeltaTime);
 
 	void RefreshViewNetworkSmoothing(float DeltaTime);
 
@@ -413,6 +478,8 @@ private:
 public:
 	const FAlsLocomotionState& GetLocomotionState() const;
 
+	const FAlsVelocityNetworkSmoothingState& GetVelocityNetworkSmoothing() const;
+
 private:
 	void SetDesiredVelocityYawAngle(float NewVelocityYawAngle);
 
@@ -422,6 +489,10 @@ private:
 
 	void RefreshLocomotionLate();
 
+	void CorrectVelocityNetworkSmoothing(const FVector& NewVelocity);
+
+	void RefreshVelocityNetworkSmoothing(float DeltaTime);
+
 	UFUNCTION(Server, Reliable)
 	void ServerSetInitialVelocityYawAngle(float NewVelocityYawAngle);
 
@@ -606,6 +677,17 @@ private:
 	UFUNCTION(Server, Unreliable)
 	void ServerSetRagdollTargetLocation(const FVector_NetQuantize& NewTargetLocation);
 
+public:
+	bool IsRagdollFullPoseReplicated() const;
+
+private:
+	void StartRagdollFullPoseInterpolation();
+
+	void RefreshRagdollFullPose(float DeltaTime);
+
+	UFUNCTION()
+	void OnReplicated_RagdollPose();
+
 	void RefreshRagdolling(float DeltaTime);
 
 	FVector RagdollTraceGround(bool& bGrounded) const;
@@ -686,6 +768,27 @@ protected:
                                             const FRotator& ClampedRotation,
                                             float ElasticStrength) const;
 
+	// Pose History
+
+public:
+	const FAlsPoseHistory& GetPoseHistory() const;
+
+	// Returns the capsule and world space bone transforms that the character had at the specified world time on the
+	// server. Bone transforms are returned in the same order as in FAlsPoseHistory::GetBoneNames(), which contains the
+	// bones from FAlsPoseHistorySettings::BoneNames that exist in the mesh.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character", Meta = (ReturnDisplayName = "Success"))
+	bool TryGetHistoricalPose(double Time, FTransform& CapsuleTransform, float& CapsuleHalfHeight,
+	                          TArray<FTransform>& BoneTransforms) const;
+
+private:
+	void StartPoseHistoryRecording();
+
+	void StopPoseHistoryRecording();
+
+	void RecordPoseHistory();
+
+	void RecordPoseHistoryBones();
+
 	// Debug
 
 public:
@@ -781,7 +884,17 @@ inline const FAlsLocomotionState& AAlsCharacter::GetLocomotionState() const
 	return LocomotionState;
 }
 
+inline const FAlsVelocityNetworkSmoothingState& AAlsCharacter::GetVelocityNetworkSmoothing() const
+{
+	return VelocityNetworkSmoothing;
+}
+
 inline const FAlsRagdollingState& AAlsCharacter::GetRagdollingState() const
 {
 	return RagdollingState;
 }
+
+inline const FAlsPoseHistory& AAlsCharacter::GetPoseHistory() const
+{
+	return PoseHistory;
+}
@@ -2,6 +2,7 @@
 
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Settings/AlsMovementSettings.h"
+#include "Utility/AlsMoveRecording.h"
 #include "AlsCharacterMovementComponent.generated.h"
 
 using FAlsPhysicsRotationDelegate = TMulticastDelegate<void(float DeltaTime)>;
@@ -64,6 +65,20 @@ public:
 
 	uint8 Saved_bPrevWantsToCrouch : 1;
 
+	// State of the blocked crouch or prone exit throttle at the start of the move, restored before the
+	// move is replayed after a correction, so that the replayed move makes the same stance exit attempts.
+	FVector Saved_BlockedStanceExitLocation{ForceInit};
+
+	FQuat Saved_BlockedStanceExitRotation{ForceInit};
+
+	TWeakObjectPtr<const UPrimitiveComponent> Saved_BlockedStanceExitBase;
+
+	float Saved_BlockedStanceExitCapsuleHalfHeight{0.0f};
+
+	float Saved_BlockedStanceExitRetryTimeRemaining{0.0f};
+
+	int32 Saved_BlockedStanceExitAttemptsCount{0};
+
 public:
 	virtual void Clear() override;
 
@@ -145,6 +160,15 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bPrePenetrationAdjustmentVelocityValid : 1 {false};
 
+	// If checked, moves received from the owning client are recorded so that they can be replayed later.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	uint8 bRecordingMoves : 1 {false};
+
+	TArray<FAlsRecordedMove> RecordedMoves;
+
+	// Number of floor queries performed since the last reset. Used to profile move processing.
+	mutable int32 FloorQueriesCount{0};
+
 public:
 	FAlsPhysicsRotationDelegate OnPhysicsRotation;
 
@@ -226,6 +250,8 @@ protected:
 
 	virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAcceleration) override;
 
+	virtual void ServerSendMoveResponse(const FClientAdjustment& PendingAdjustment) override;
+
 	virtual void RefreshGaitSettings();
 
 public:
@@ -264,6 +290,41 @@ public:
 
 	bool TryConsumePrePenetrationAdjustmentVelocity(FVector& OutVelocity);
 
+	int32 GetFloorQueriesCount() const;
+
+	// Move Recording
+
+public:
+	bool IsRecordingMoves() const;
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character Movement")
+	void SetRecordingMoves(bool bNewRecordingMoves);
+
+	const TArray<FAlsRecordedMove>& GetRecordedMoves() const;
+
+	void ClearRecordedMoves();
+
+	// Replays the moves against this component on the authority and compares the results with the recorded ones. The character's
+	// transform, velocity, movement mode and stance are restored afterwards. Intended for profiling and regression testing of
+	// server move processing.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character Movement", Meta = (ReturnDisplayName = "Result"))
+	FAlsMoveReplayResult ReplayMoves(const TArray<FAlsRecordedMove>& Moves, float LocationTolerance = 1.0f);
+
+	static bool SaveMovesToFile(const TArray<FAlsRecordedMove>& Moves, const FString& FilePath);
+
+	static bool LoadMovesFromFile(const FString& FilePath, TArray<FAlsRecordedMove>& Moves);
+
+private:
+	FAlsRecordedMove* StartRecordingMove(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAcceleration);
+
+	void RecordMoveStartState(FAlsRecordedMove& Move) const;
+
+	void FinishRecordingMove(FAlsRecordedMove& Move) const;
+
+	void RestoreRecordedStance(const FAlsRecordedMove& Move);
+
+	void RestoreRecordedMoveStartState(const FAlsRecordedMove& Move);
+
 public:
 	UPROPERTY(Category="Als Character Movement: Walking", EditAnywhere, BlueprintReadWrite, meta=(ClampMin="0", UIMin="0", ForceUnits="cm/s"))
 	float MaxWalkSpeedProned;
@@ -283,6 +344,18 @@ public:
 	UPROPERTY(Category="Character Movement (General Settings)", VisibleInstanceOnly, BlueprintReadWrite, AdvancedDisplay)
 	uint8 bProneMaintainsBaseLocation:1;
 
+	// If checked, a blocked attempt to leave the crouch or prone stance is not repeated while the capsule and
+	// its movement base stay in place, until the retry interval expires. The interval doubles after each blocked
+	// attempt up to the maximum, and is measured in simulated move time, so clients and the server back off alike.
+	UPROPERTY(Category="Character Movement (General Settings)", EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	uint8 bThrottleBlockedStanceExit:1;
+
+	UPROPERTY(Category="Character Movement (General Settings)", EditAnywhere, BlueprintReadWrite, AdvancedDisplay, meta=(ClampMin="0", UIMin="0", ForceUnits="s", EditCondition="bThrottleBlockedStanceExit"))
+	float BlockedStanceExitRetryInterval;
+
+	UPROPERTY(Category="Character Movement (General Settings)", EditAnywhere, BlueprintReadWrite, AdvancedDisplay, meta=(ClampMin="0", UIMin="0", ForceUnits="s", EditCondition="bThrottleBlockedStanceExit"))
+	float BlockedStanceExitMaxRetryInterval;
+
 public:
 	virtual void Prone(bool bClientSimulation = false);
 	
@@ -299,6 +372,18 @@ public:
 public:
 	virtual bool IsProning() const;
 
+	// Resets the stance, slide and movement state, so that the component can be reused by a pooled character.
+	void ResetForReuse();
+
+private:
+	void TryUnCrouch();
+
+	void TryUnProne();
+
+	bool IsStanceExitBlocked() const;
+
+	void RefreshBlockedStanceExit(bool bBlocked);
+
 public:
 	UPROPERTY(Category = "Character Movement: Sliding", EditAnywhere, BlueprintReadWrite)
 	ESlideTriggerType SlideTriggerType = ESlideTriggerType::ESTT_SingleTap;
@@ -336,11 +421,34 @@ public:
 protected:
 	bool Safe_bPrevWantsToCrouch;
 
+	// Result of the last slide surface trace, reused while the capsule stays in place.
+	mutable FVector SlideSurfaceTraceLocation{ForceInit};
+
+	mutable TWeakObjectPtr<const UPrimitiveComponent> SlideSurfaceTraceBase;
+
+	mutable uint8 bSlideSurfaceTraceValid : 1 {false};
+
+	mutable uint8 bSlideSurfaceTraceHit : 1 {false};
+
+	// State of the last blocked crouch or prone exit attempt. See bThrottleBlockedStanceExit.
+	FVector BlockedStanceExitLocation{ForceInit};
+
+	FQuat BlockedStanceExitRotation{ForceInit};
+
+	TWeakObjectPtr<const UPrimitiveComponent> BlockedStanceExitBase;
+
+	float BlockedStanceExitCapsuleHalfHeight{0.0f};
+
+	float BlockedStanceExitRetryTimeRemaining{0.0f};
+
+	int32 BlockedStanceExitAttemptsCount{0};
+
 protected:
 	bool IsSlideTriggered() const;
 	void EnterSlide(EMovementMode PrevMode, ECustomMovementMode PrevCustomMode);
 	void ExitSlide();
 	bool CanSlide(bool bCheckSpeed = true) const;
+	bool HasSlideSurface() const;
 	void PhysSlide(float deltaTime, int32 Iterations);
 };
 
@@ -373,3 +481,18 @@ inline float UAlsCharacterMovementComponent::GetGaitAmount() const
 {
 	return GaitAmount;
 }
+
+inline int32 UAlsCharacterMovementComponent::GetFloorQueriesCount() const
+{
+	return FloorQueriesCount;
+}
+
+inline bool UAlsCharacterMovementComponent::IsRecordingMoves() const
+{
+	return bRecordingMoves;
+}
+
+inline const TArray<FAlsRecordedMove>& UAlsCharacterMovementComponent::GetRecordedMoves() const
+{
+	return RecordedMoves;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsCharacterPoolSubsystem.generated.h"
+
+class AAlsCharacter;
+class UActorComponent;
+
+USTRUCT()
+struct ALS_API FAlsPooledCharacter
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	TObjectPtr<AAlsCharacter> Character;
+
+	// Tick states the character had when it was put into the pool, which are restored when it is taken from the pool,
+	// since they may differ from the tick states the character and its components start with.
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	uint8 bActorTickEnabled : 1 {false};
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	TArray<TObjectPtr<UActorComponent>> TickEnabledComponents;
+};
+
+USTRUCT()
+struct ALS_API FAlsCharacterPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	TArray<FAlsPooledCharacter> Characters;
+};
+
+// Keeps dormant, fully initialized characters, so that they can be reused instead of being spawned on demand,
+// which avoids the cost of the actor, components and animation instance initialization in the middle of gameplay.
+// The animation graph nodes of a reused character are re-initialized rather than re-created, so custom
+// animation nodes must reset all of their state in Initialize_AnyThread() to be compatible with the pool.
+UCLASS()
+class ALS_API UAlsCharacterPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TMap<TSubclassOf<AAlsCharacter>, FAlsCharacterPool> Pools;
+
+public:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+	virtual void Deinitialize() override;
+
+	// Spawns characters of the specified class and puts them into the pool until the pool has the specified number of characters.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character Pool")
+	void Prewarm(TSubclassOf<AAlsCharacter> CharacterClass, int32 Count);
+
+	// Takes a character of the specified class from the pool, or spawns a new one if the pool is empty.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character Pool", Meta = (DeterminesOutputType = "CharacterClass"))
+	AAlsCharacter* AcquireCharacter(TSubclassOf<AAlsCharacter> CharacterClass, const FTransform& Transform);
+
+	// Resets the character and puts it back into the pool instead of destroying it.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character Pool")
+	void ReleaseCharacter(AAlsCharacter* Character);
+
+	UFUNCTION(BlueprintPure, Category = "ALS|Character Pool", Meta = (ReturnDisplayName = "Count"))
+	int32 GetPooledCharactersCount(TSubclassOf<AAlsCharacter> CharacterClass) const;
+
+private:
+	AAlsCharacter* SpawnPooledCharacter(TSubclassOf<AAlsCharacter> CharacterClass, const FTransform& Transform) const;
+
+	static void ActivateCharacter(const FAlsPooledCharacter& PooledCharacter);
+
+	static FAlsPooledCharacter DeactivateCharacter(AAlsCharacter& Character);
+};
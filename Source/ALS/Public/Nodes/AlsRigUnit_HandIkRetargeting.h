@@ -49,6 +49,18 @@ public:
 	UPROPERTY(Transient)
 	TArray<FCachedRigElement> CachedItemsToMove;
 
+	// Items that are already moved along with one of their ancestors from the items to move when
+	// propagating to children, so they don't need to be moved a second time. Refreshed only when
+	// the items to move or the hierarchy topology change.
+	UPROPERTY(Transient)
+	TArray<bool> CachedItemsMovedByAncestor;
+
+	UPROPERTY(Transient)
+	uint32 CachedTopologyVersion{0};
+
+	UPROPERTY(Transient)
+	TArray<FTransform> ItemsToMoveTransforms;
+
 public:
 	RIGVM_METHOD()
 	virtual void Execute() override;
@@ -2,6 +2,8 @@
 
 #include "AlsInAirRotationMode.h"
 #include "AlsMantlingSettings.h"
+#include "AlsOverlaySettings.h"
+#include "AlsPoseHistorySettings.h"
 #include "AlsRagdollingSettings.h"
 #include "AlsRollingSettings.h"
 #include "AlsViewSettings.h"
@@ -93,6 +95,17 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
 	float MovingSpeedThreshold{50.0f};
 
+	// If checked, the velocity, acceleration and input direction of simulated proxies are smoothed between network updates,
+	// and the velocity is extrapolated using the acceleration estimated from the last two updates, so that the locomotion
+	// state, gait blends, leans and turn in place don't pop when network updates are rare, for example, when the net update
+	// frequency of distant characters is lowered. Independent of the view network smoothing, which is usually enabled too.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	uint8 bEnableVelocityNetworkSmoothing : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings",
+		Meta = (ClampMin = 0, EditCondition = "bEnableVelocityNetworkSmoothing", ForceUnits = "s"))
+	float MaxVelocityExtrapolationTime{0.25f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	EAlsInAirRotationMode InAirRotationMode{EAlsInAirRotationMode::RotateToVelocityOnJump};
 
@@ -119,6 +132,16 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	uint8 bAutoRotateOnAnyInputWhileNotMovingInViewDirectionRotationMode : 1 {true};
 
+	// If greater than zero, on dedicated servers, the parts of the character logic that nothing else reads in the same frame
+	// (view network smoothing, in air rotation, control rotation limits and in air mantling checks) run at this fixed rate
+	// instead of every frame. The view itself is still refreshed every frame, since the gait and rotations depend on it.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "Hz"))
+	float DedicatedServerFixedLogicRate{0.0f};
+
+	// Maximum number of fixed rate logic steps per frame, the remaining time of long frames is discarded.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 1))
+	int32 MaxDedicatedServerFixedLogicSteps{4};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsViewSettings View;
 
@@ -131,6 +154,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsRollingSettings Rolling;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsOverlaySettings Overlay;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsPoseHistorySettings PoseHistory;
+
 public:
 	UAlsCharacterSettings();
 
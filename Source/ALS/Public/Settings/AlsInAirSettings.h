@@ -28,6 +28,32 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "ALS", AdvancedDisplay)
 	FCollisionResponseContainer GroundPredictionSweepResponses{ECR_Ignore};
 
+	// If checked, the landing trajectory is predicted once from the current velocity and gravity and checked with a few
+	// asynchronous sweeps. The result is reused until the velocity or the landing surface changes noticeably. Otherwise,
+	// a synchronous sweep in the direction of the velocity is performed every frame while falling.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bUseBallisticGroundPrediction : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0.1, EditCondition = "bUseBallisticGroundPrediction", ForceUnits = "s"))
+	float BallisticGroundPredictionMaxTime{2.0f};
+
+	// The number of sweeps the predicted trajectory is divided into.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, ClampMax = 16, EditCondition = "bUseBallisticGroundPrediction"))
+	int32 BallisticGroundPredictionSweepsCount{4};
+
+	// The trajectory is predicted again if the actual velocity differs from the predicted velocity by more than this value.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bUseBallisticGroundPrediction", ForceUnits = "cm/s"))
+	float BallisticGroundPredictionVelocityTolerance{100.0f};
+
+	// The trajectory is predicted again if the actual location differs from the predicted
+	// location, or the landing surface moves, by more than this value.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bUseBallisticGroundPrediction", ForceUnits = "cm"))
+	float BallisticGroundPredictionLocationTolerance{50.0f};
+
 public:
 #if WITH_EDITOR
 	void PostEditChangeProperty(const FPropertyChangedEvent& ChangedEvent);
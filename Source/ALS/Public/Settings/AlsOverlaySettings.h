@@ -0,0 +1,28 @@
+﻿#pragma once
+
+#include "GameplayTagContainer.h"
+#include "AlsOverlaySettings.generated.h"
+
+class UAnimInstance;
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsOverlaySettings
+{
+	GENERATED_BODY()
+
+	// Animation layer classes that are linked to the character's mesh when the corresponding overlay mode is set. Layer
+	// classes are loaded asynchronously, the previous layers stay linked until loading is complete. Overlay modes that
+	// are not in this map are left to AAlsCharacter::OnOverlayModeChanged() as before.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceInlineRow, Categories = "Als.OverlayMode"))
+	TMap<FGameplayTag, TSoftClassPtr<UAnimInstance>> LayerClasses;
+
+	// Layer classes of these overlay modes are loaded asynchronously as soon as the character begins play
+	// and stay loaded during its lifetime. Usually these are the overlay modes that can be switched to often.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (Categories = "Als.OverlayMode"))
+	FGameplayTagContainer PreloadedOverlayModes;
+
+	// Number of recently linked layer classes (including the currently linked one) that each character keeps
+	// loaded, so that switching back to them doesn't require loading their classes and animations again.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 1))
+	int32 MaxCachedLayerClasses{3};
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "AlsPoseHistorySettings.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsPoseHistorySettings
+{
+	GENERATED_BODY()
+
+	// If checked, the server records the character's capsule and bone transforms into a fixed size history, which can be
+	// queried with AAlsCharacter::TryGetHistoricalPose() for lag compensated hit validation. The capsule is recorded every
+	// frame, but bones are only sampled when the pose is refreshed, so the mesh must be updated on the server, for example
+	// with the "Always Tick Pose and Refresh Bones" option, for bone transforms to be up to date.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bEnabled : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0.01, ForceUnits = "s"))
+	float HistoryDuration{1.0f};
+
+	// Maximum number of frames recorded per second. Together with the history duration, it determines the history
+	// capacity, so that the history always covers its duration regardless of the server frame rate.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 1, ForceUnits = "Hz"))
+	float MaxRecordingRate{60.0f};
+
+	// Bones recorded in each frame. Historical bone transforms are returned in the same order.
+	// Bones that don't exist in the mesh are skipped with a warning.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FName> BoneNames;
+};
@@ -24,6 +24,23 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bLimitInitialRagdollSpeed : 1 {true};
 
+	// If checked, the authority replicates compressed transforms of the full pose bodies, and remote clients
+	// move these bodies kinematically instead of simulating the entire ragdoll and pulling it towards the
+	// target location. This reduces the physics cost on clients and keeps ragdoll poses consistent between
+	// them. Only used when ragdoll replication is enabled on the character.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bReplicateFullPose : 1 {false};
+
+	// How many times per second the full pose is sent to clients.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, EditCondition = "bReplicateFullPose", ForceUnits = "Hz"))
+	float FullPoseReplicationRate{15.0f};
+
+	// Bodies whose transforms are replicated when full pose replication is enabled. The first body is used as the root of
+	// the pose. Bodies not listed here remain simulated on clients and follow the replicated bodies through constraints.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bReplicateFullPose"))
+	TArray<FName> FullPoseBodyNames;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UAnimMontage> GetUpFrontMontage;
 
@@ -7,41 +7,44 @@ struct ALS_API FAlsFootState
 {
 	GENERATED_BODY()
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
-	float LockAmount{0.0f};
+	// Members are ordered by how often they are accessed during the foot update,
+	// the thigh axis is only read to limit the lock angle while the foot is locked.
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	FVector3f ThighAxis{ForceInit};
+	FVector TargetLocation{ForceInit};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	FVector TargetLocation{ForceInit};
+	FVector LockLocation{ForceInit};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	FQuat TargetRotation{ForceInit};
+	FQuat4f TargetRotation{ForceInit};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	FVector LockLocation{ForceInit};
+	FQuat4f LockRotation{ForceInit};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	FQuat LockRotation{ForceInit};
+	FQuat4f LockComponentRelativeRotation{ForceInit};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	FVector3f LockComponentRelativeLocation{ForceInit};
+	FQuat4f LockMovementBaseRelativeRotation{ForceInit};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	FQuat4f LockComponentRelativeRotation{ForceInit};
+	FQuat4f FinalRotation{ForceInit};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	FVector3f LockMovementBaseRelativeLocation{ForceInit};
+	FVector3f LockComponentRelativeLocation{ForceInit};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	FQuat4f LockMovementBaseRelativeRotation{ForceInit};
+	FVector3f LockMovementBaseRelativeLocation{ForceInit};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FVector3f FinalLocation{ForceInit};
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
+	float LockAmount{0.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	FQuat4f FinalRotation{ForceInit};
+	FVector3f ThighAxis{ForceInit};
 };
 
 USTRUCT(BlueprintType)
@@ -1,7 +1,10 @@
 #pragma once
 
+#include "WorldCollision.h"
 #include "AlsInAirState.generated.h"
 
+class UPrimitiveComponent;
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsInAirState
 {
@@ -22,3 +25,73 @@ struct ALS_API FAlsInAirState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
 	float GroundPredictionAmount{1.0f};
 };
+
+struct ALS_API FAlsBallisticGroundPredictionState
+{
+	// Sweeps along the predicted trajectory that have not yet been completed, in trajectory order.
+	TArray<FTraceHandle, TInlineAllocator<16>> SweepHandles;
+
+	FVector StartLocation{ForceInit};
+
+	FVector StartVelocity{ForceInit};
+
+	float GravityZ{0.0f};
+
+	// The vertical velocity is clamped to this value, similar to the terminal velocity of the physics volume.
+	float MinVerticalVelocity{-4000.0f};
+
+	double StartTime{0.0};
+
+	bool bValid{false};
+
+	bool bGroundFound{false};
+
+	FVector LandingLocation{ForceInit};
+
+	TWeakObjectPtr<const UPrimitiveComponent> LandingPrimitive;
+
+	FVector LandingPrimitiveLocation{ForceInit};
+
+public:
+	FVector GetLocation(double Time) const;
+
+	FVector GetVelocity(double Time) const;
+
+	// Returns the time at which the vertical velocity reaches the minimum vertical velocity.
+	double GetMinVerticalVelocityTime() const;
+
+	void Reset();
+};
+
+inline FVector FAlsBallisticGroundPredictionState::GetLocation(const double Time) const
+{
+	const auto AccelerationTime{FMath::Min(Time, GetMinVerticalVelocityTime())};
+
+	// After the minimum vertical velocity is reached, the character keeps falling at a constant velocity.
+
+	return StartLocation + StartVelocity * Time +
+	       FVector{0.0f, 0.0f, GravityZ * AccelerationTime * (Time - AccelerationTime * 0.5)};
+}
+
+inline FVector FAlsBallisticGroundPredictionState::GetVelocity(const double Time) const
+{
+	return StartVelocity + FVector{0.0f, 0.0f, GravityZ * FMath::Min(Time, GetMinVerticalVelocityTime())};
+}
+
+inline double FAlsBallisticGroundPredictionState::GetMinVerticalVelocityTime() const
+{
+	if (GravityZ >= 0.0f)
+	{
+		return TNumericLimits<double>::Max();
+	}
+
+	return FMath::Max(0.0, (MinVerticalVelocity - StartVelocity.Z) / GravityZ);
+}
+
+inline void FAlsBallisticGroundPredictionState::Reset()
+{
+	SweepHandles.Reset();
+	bValid = false;
+	bGroundFound = false;
+	LandingPrimitive.Reset();
+}
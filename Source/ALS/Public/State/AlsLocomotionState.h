@@ -2,6 +2,71 @@
 
 #include "AlsLocomotionState.generated.h"
 
+USTRUCT(BlueprintType)
+struct ALS_API FAlsVelocityNetworkSmoothingState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bEnabled : 1 {false};
+
+	// Server time of the last received velocity.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float ServerTime{0.0f};
+
+	// Time elapsed since the last received velocity.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float ElapsedTime{0.0f};
+
+	// Time over which the offsets between the current and the extrapolated server values are blended out.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float Duration{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "cm/s"))
+	FVector ServerVelocity{ForceInit};
+
+	// Estimated from the last two received velocities.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "cm/s^2"))
+	FVector ServerAcceleration{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector ServerInputDirection{ForceInit};
+
+	// Offset of the current velocity from the extrapolated server velocity at the time of the last received velocity.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "cm/s"))
+	FVector VelocityOffset{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "cm/s^2"))
+	FVector AccelerationOffset{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector InitialInputDirection{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "cm/s"))
+	FVector CurrentVelocity{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "cm/s^2"))
+	FVector CurrentAcceleration{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector CurrentInputDirection{ForceInit};
+
+public:
+	// Immediately sets the current values to the new server values, without any extrapolation.
+	void Snap(float NewServerTime, const FVector& NewVelocity, const FVector& NewInputDirection);
+
+	// Starts blending towards the new server values. Snaps to them if the time since
+	// the previous server values is unknown or too long to estimate the acceleration.
+	void Correct(float NewServerTime, const FVector& NewVelocity, const FVector& NewInputDirection,
+	             float MaxServerDeltaTime, float MaxExtrapolationTime, float MaxSpeed);
+
+	void Refresh(float DeltaTime, float MaxExtrapolationTime, float MaxSpeed);
+
+private:
+	void CalculateTargetVelocityAndAcceleration(float MaxExtrapolationTime, float MaxSpeed,
+	                                            FVector& TargetVelocity, FVector& TargetAcceleration) const;
+};
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsLocomotionState
 {
@@ -10,12 +75,24 @@ struct ALS_API FAlsLocomotionState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bHasInput : 1 {false};
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
-	float InputYawAngle{0.0f};
-
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bHasVelocity : 1 {false};
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bMoving : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bRotationTowardsLastInputDirectionBlocked : 1 {true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bAimingLimitAppliedThisFrame : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bResetAimingLimit : 1 {true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float InputYawAngle{0.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
 	float Speed{0.0f};
 
@@ -25,12 +102,6 @@ struct ALS_API FAlsLocomotionState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
 	float VelocityYawAngle{0.0f};
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	uint8 bMoving : 1 {false};
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	uint8 bRotationTowardsLastInputDirectionBlocked : 1 {true};
-
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
 	float TargetYawAngle{0.0f};
 
@@ -44,10 +115,4 @@ struct ALS_API FAlsLocomotionState
 	// Specifies the maximum angle by which the actor's rotation can differ from the view rotation when aiming.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 180, ForceUnits = "deg"))
 	float AimingYawAngleLimit{180.0f};
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	uint8 bAimingLimitAppliedThisFrame : 1 {false};
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	uint8 bResetAimingLimit : 1 {true};
 };
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Math/Transform.h"
+
+class USkeletalMeshComponent;
+struct FAlsPoseHistorySettings;
+
+// Quaternion with each component quantized to 16 bits.
+struct ALS_API FAlsPoseHistoryQuat
+{
+	int16 X{0};
+	int16 Y{0};
+	int16 Z{0};
+	int16 W{MAX_int16};
+
+public:
+	void Quantize(const FQuat& Quat);
+
+	FQuat Dequantize() const;
+};
+
+struct ALS_API FAlsPoseHistoryBone
+{
+	// Bone location relative to the capsule, quantized to 0.1 cm in the range of +-3276.7 cm.
+	int16 Location[3]{0, 0, 0};
+
+	FAlsPoseHistoryQuat Rotation;
+};
+
+struct ALS_API FAlsPoseHistoryFrame
+{
+	double Time{0.0};
+
+	FVector CapsuleLocation{ForceInit};
+
+	FAlsPoseHistoryQuat CapsuleRotation;
+
+	float CapsuleHalfHeight{0.0f};
+};
+
+// Fixed size ring buffer of the character's capsule and bone transforms. All memory is allocated on initialization,
+// recording overwrites the oldest frame once the history is full. Frames are recorded independently of the mesh, and bone
+// transforms are taken from the already evaluated component space pose of the mesh whenever it is refreshed, so recording
+// doesn't require any additional animation evaluation. Frames recorded while the pose is not refreshed reuse the latest pose.
+class ALS_API FAlsPoseHistory
+{
+private:
+	TArray<FAlsPoseHistoryFrame> Frames;
+
+	// Bones of all frames, BoneIndices.Num() bones per frame, stored in the same order as the frames.
+	TArray<FAlsPoseHistoryBone> Bones;
+
+	// Bones of the latest refreshed pose, which are copied into each new frame.
+	TArray<FAlsPoseHistoryBone> LatestBones;
+
+	TArray<int32> BoneIndices;
+
+	TArray<FName> BoneNames;
+
+	double MinRecordingInterval{0.0};
+
+	int32 NewestFrameIndex{INDEX_NONE};
+
+	int32 FramesCount{0};
+
+public:
+	void Initialize(const USkeletalMeshComponent& Mesh, const FAlsPoseHistorySettings& Settings);
+
+	void Reset();
+
+	// Removes all recorded frames, but keeps the memory allocated.
+	void Clear();
+
+	bool IsInitialized() const;
+
+	int32 GetFramesCount() const;
+
+	int32 GetBonesCount() const;
+
+	// Names of the recorded bones. Bones from the settings that don't exist in the mesh are skipped.
+	const TArray<FName>& GetBoneNames() const;
+
+	SIZE_T GetAllocatedSize() const;
+
+	// Records a new frame with the latest refreshed pose, unless the previous frame is more recent than the recording interval.
+	void Record(double Time, const FTransform& CapsuleTransform, float CapsuleHalfHeight);
+
+	// Must be called after the pose of the mesh is refreshed. Updates the latest pose, and if a frame has already been
+	// recorded at the same time, also updates that frame, so that its bone transforms match its capsule transform.
+	void RecordBones(double Time, const FTransform& CapsuleTransform, float CapsuleHalfHeight, const USkeletalMeshComponent& Mesh);
+
+	// Returns the capsule and world space bone transforms at the specified time, interpolated between the two nearest
+	// frames. Times newer than the newest frame return the newest frame, times older than the oldest frame fail.
+	bool TryGetPose(double Time, FTransform& CapsuleTransform, float& CapsuleHalfHeight, TArray<FTransform>& BoneTransforms) const;
+
+private:
+	// Converts an index from oldest to newest frame into an index in the frames array.
+	int32 GetFrameIndex(int32 Index) const;
+};
+
+inline bool FAlsPoseHistory::IsInitialized() const
+{
+	return !Frames.IsEmpty();
+}
+
+inline void FAlsPoseHistory::Clear()
+{
+	NewestFrameIndex = INDEX_NONE;
+	FramesCount = 0;
+}
+
+inline int32 FAlsPoseHistory::GetFramesCount() const
+{
+	return FramesCount;
+}
+
+inline int32 FAlsPoseHistory::GetBonesCount() const
+{
+	return BoneIndices.Num();
+}
+
+inline const TArray<FName>& FAlsPoseHistory::GetBoneNames() const
+{
+	return BoneNames;
+}
+
+inline int32 FAlsPoseHistory::GetFrameIndex(const int32 Index) const
+{
+	return (NewestFrameIndex - FramesCount + 1 + Index + Frames.Num()) % Frames.Num();
+}
@@ -0,0 +1,48 @@
+﻿#pragma once
+
+#include "Engine/NetSerialization.h"
+#include "AlsRagdollPose.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsRagdollBodyPose
+{
+	GENERATED_BODY()
+
+	// Body location relative to the ragdoll root location.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector Location{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator Rotation{ForceInit};
+
+public:
+	// Rounds the location and rotation to the same precision that is used for network serialization, so that
+	// small simulation jitter does not cause the body to be considered changed and replicated again.
+	void Quantize();
+
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsRagdollBodyPose> : public TStructOpsTypeTraitsBase2<FAlsRagdollBodyPose>
+{
+	enum // NOLINT(performance-enum-size)
+	{
+		WithNetSerializer = true
+	};
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsRagdollPose
+{
+	GENERATED_BODY()
+
+	// World location of the first body. Locations of all bodies are stored relative to it.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector_NetQuantize RootLocation{ForceInit};
+
+	// Bodies are stored in the same order as in FAlsRagdollingSettings::FullPoseBodyNames. Since each body
+	// is replicated as a separate array element, only bodies that have changed since the last update are sent.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FAlsRagdollBodyPose> Bodies;
+};
@@ -2,6 +2,24 @@
 
 #include "AlsRagdollingState.generated.h"
 
+// Body that is not replicated in the full pose mode and instead follows the closest replicated ancestor body.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsRagdollFollowerBody
+{
+	GENERATED_BODY()
+
+	// Index of the body in the skeletal mesh component bodies array.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 BodyIndex{INDEX_NONE};
+
+	// Index of the followed body in FAlsRagdollingSettings::FullPoseBodyNames.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 ParentPoseBodyIndex{INDEX_NONE};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FTransform RelativeTransform{FTransform::Identity};
+};
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsRagdollingState
 {
@@ -18,4 +36,23 @@ struct ALS_API FAlsRagdollingState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
 	float SpeedLimit{0.0f};
+
+	// Time remaining until the next full pose update is sent. Used only on the authority.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
+	float FullPoseReplicationTimeRemaining{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
+	float FullPoseInterpolationAmount{1.0f};
+
+	// World space transforms of the full pose bodies from which the interpolation starts. Used only on remote clients.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FTransform> FullPoseSourceTransforms;
+
+	// World space transforms of the full pose bodies to which the interpolation goes. Used only on remote clients.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FTransform> FullPoseTargetTransforms;
+
+	// Bodies that are not part of the full pose, but are moved kinematically along with it. Used only on remote clients.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FAlsRagdollFollowerBody> FullPoseFollowerBodies;
 };
@@ -12,6 +12,12 @@ struct ALS_API FAlsTransitionsState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bTransitionsAllowed : 1 {false};
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bStopTransitionsQueued : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float QueuedStopTransitionsBlendOutDuration{-1.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UAnimSequenceBase> QueuedTransitionSequence;
 
@@ -26,10 +32,4 @@ struct ALS_API FAlsTransitionsState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
 	float QueuedTransitionStartTime{0.0f};
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	uint8 bStopTransitionsQueued : 1 {false};
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
-	float QueuedStopTransitionsBlendOutDuration{-1.0f};
 };
@@ -9,12 +9,14 @@ struct ALS_API FAlsTurnInPlaceState
 {
 	GENERATED_BODY()
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	uint8 bUpdatedThisFrame : 1 {false};
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "x"))
+	float PlayRate{1.0f};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
 	float ActivationDelay{0.0f};
 
+	// The queued turn is read only when a turn in place animation starts.
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UAlsTurnInPlaceSettings> QueuedSettings;
 
@@ -24,6 +26,7 @@ struct ALS_API FAlsTurnInPlaceState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 180, ForceUnits = "deg"))
 	float QueuedTurnYawAngle{0.0f};
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "x"))
-	float PlayRate{1.0f};
+	// Placed last to fill the tail padding.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bUpdatedThisFrame : 1 {false};
 };
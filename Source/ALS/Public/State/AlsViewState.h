@@ -37,9 +37,6 @@ struct ALS_API FAlsViewState
 {
 	GENERATED_BODY()
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
-	FAlsViewNetworkSmoothingState NetworkSmoothing;
-
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FRotator Rotation{ForceInit};
 
@@ -48,4 +45,8 @@ struct ALS_API FAlsViewState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
 	float PreviousYawAngle{0.0f};
+
+	// Used only on simulated proxies and listen servers, so it is placed after the members read every frame.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsViewNetworkSmoothingState NetworkSmoothing;
 };
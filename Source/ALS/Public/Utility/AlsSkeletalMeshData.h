@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Templates/SharedPointer.h"
+
+class USkinnedAsset;
+
+// Everything that ALS derives from the reference skeleton of a skinned asset. It is built once per
+// asset and shared by all animation instances and characters using that asset, so it is immutable.
+struct ALS_API FAlsSkeletalMeshData
+{
+	int32 PelvisBoneIndex{INDEX_NONE};
+
+	int32 FootLeftIkBoneIndex{INDEX_NONE};
+
+	int32 FootRightIkBoneIndex{INDEX_NONE};
+
+	int32 FootLeftVirtualBoneIndex{INDEX_NONE};
+
+	int32 FootRightVirtualBoneIndex{INDEX_NONE};
+
+	FVector3f ThighLeftAxis{-FVector3f::ZAxisVector};
+
+	FVector3f ThighRightAxis{FVector3f::ZAxisVector};
+
+#if WITH_EDITOR
+	// Number of bones in the reference skeleton at the time the data was built. Used
+	// to detect reference skeleton changes, such as reimports or new virtual bones.
+	int32 BonesCount{0};
+#endif
+
+public:
+	bool HasFootIkBones() const;
+
+	bool HasFootVirtualBones() const;
+
+	// Returns the shared data of the skinned asset, building it on the first request.
+	static TSharedRef<const FAlsSkeletalMeshData> Get(const USkinnedAsset& SkinnedAsset);
+
+	// Discards the data of all skinned assets. Instances that already hold the data keep it alive.
+	static void Reset();
+
+private:
+	static TSharedRef<const FAlsSkeletalMeshData> Build(const USkinnedAsset& SkinnedAsset);
+};
+
+inline bool FAlsSkeletalMeshData::HasFootIkBones() const
+{
+	return FootLeftIkBoneIndex >= 0 && FootRightIkBoneIndex >= 0;
+}
+
+inline bool FAlsSkeletalMeshData::HasFootVirtualBones() const
+{
+	return FootLeftVirtualBoneIndex >= 0 && FootRightVirtualBoneIndex >= 0;
+}
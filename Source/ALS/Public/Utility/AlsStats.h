@@ -0,0 +1,141 @@
+#pragma once
+
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+#include "Utility/AlsTrace.h"
+#include "Utility/AlsUtility.h"
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ALS_API, AlsCharacter);
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ALS_API, AlsMovement);
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ALS_API, AlsCamera);
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ALS_API, AlsSceneQueries);
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ALS_API, AlsNetwork);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mantling Scene Queries"), STAT_Als_MantlingSceneQueries, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Foot Ik Scene Queries"), STAT_Als_FootIkSceneQueries, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ground Prediction Scene Queries"), STAT_Als_GroundPredictionSceneQueries, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Camera Scene Queries"), STAT_Als_CameraSceneQueries, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Footstep Scene Queries"), STAT_Als_FootstepSceneQueries, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Slide Scene Queries"), STAT_Als_SlideSceneQueries, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Prone Scene Queries"), STAT_Als_ProneSceneQueries, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ragdolling Scene Queries"), STAT_Als_RagdollingSceneQueries, STATGROUP_Als, ALS_API);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AlsChar ClientUpdatePositionAfterServerUpdate"),
+                          STAT_AlsCharacterMovementClientUpdatePositionAfterServerUpdate, STATGROUP_Als, ALS_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Stance Exit Attempts"), STAT_Als_StanceExitAttempts, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Stance Exit Attempts Skipped"), STAT_Als_StanceExitAttemptsSkipped, STATGROUP_Als, ALS_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mesh Rotation Syncs Skipped"), STAT_Als_MeshRotationSyncsSkipped, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mesh Rotation Syncs Lightweight"), STAT_Als_MeshRotationSyncsLightweight, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mesh Rotation Syncs Full"), STAT_Als_MeshRotationSyncsFull, STATGROUP_Als, ALS_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Server RPCs Received"), STAT_Als_ServerRpcsReceived, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Client RPCs Received"), STAT_Als_ClientRpcsReceived, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Multicast RPCs Sent"), STAT_Als_MulticastRpcsSent, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Server Movement Corrections"), STAT_Als_ServerMovementCorrections, STATGROUP_Als, ALS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Client Movement Corrections"), STAT_Als_ClientMovementCorrections, STATGROUP_Als, ALS_API);
+
+#if !UE_BUILD_SHIPPING
+// Accumulates the total number of each network event while enabled, unlike the stats above, which are reset every frame.
+// Used by benchmarks to report network events per type. Must only be used on the game thread.
+class ALS_API FAlsNetworkEventCounters
+{
+private:
+	static bool bEnabled;
+
+	static TMap<FName, int64> Counts;
+
+public:
+	static bool IsEnabled();
+
+	static void SetEnabled(bool bNewEnabled);
+
+	static void Increment(const FName& EventName);
+
+	static const TMap<FName, int64>& GetCounts();
+
+	static void Reset();
+};
+
+inline bool FAlsNetworkEventCounters::IsEnabled()
+{
+	return bEnabled;
+}
+
+inline const TMap<FName, int64>& FAlsNetworkEventCounters::GetCounts()
+{
+	return Counts;
+}
+
+#define ALS_ACCUMULATE_NETWORK_EVENT(EventName) \
+	do \
+	{ \
+		if (FAlsNetworkEventCounters::IsEnabled()) \
+		{ \
+			FAlsNetworkEventCounters::Increment(TEXT(#EventName)); \
+		} \
+	} while (false)
+#else
+#define ALS_ACCUMULATE_NETWORK_EVENT(EventName) do {} while (false)
+#endif
+
+// Profiles a stage of the ALS logic. The time is displayed by the "Stat Als" command, recorded by the CSV profiler
+// under the given category (categories are disabled by default, enable them with "-csvCategories=AlsCharacter,..."),
+// and displayed in Unreal Insights.
+
+#define ALS_SCOPED_STAGE_STAT(CsvCategory, StageName) \
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT(#CsvCategory "::" #StageName), STAT_##CsvCategory##_##StageName, STATGROUP_Als) \
+	CSV_SCOPED_TIMING_STAT(CsvCategory, StageName); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
+
+// Profiles a stage that runs several times per move, such as the floor distance computation. Only a quick cycle counter
+// is used, since the CSV profiler and Unreal Insights scopes of ALS_SCOPED_STAGE_STAT() are too costly at this frequency.
+
+#if STATS
+#define ALS_SCOPED_HOT_STAGE_STAT(CsvCategory, StageName) \
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_##CsvCategory##_##StageName)
+#else
+#define ALS_SCOPED_HOT_STAGE_STAT(CsvCategory, StageName)
+#endif
+
+// Counts scene queries (traces, sweeps and overlaps) performed by an ALS subsystem for the given actor. Totals per frame are
+// displayed by the "Stat Als" command and recorded by the CSV profiler under the "AlsSceneQueries" category, and counts
+// per actor are recorded into the "Als" trace channel.
+
+#define ALS_COUNT_SCENE_QUERIES(Actor, StatName, SubsystemName, Count) \
+	do \
+	{ \
+		INC_DWORD_STAT_BY(StatName, Count); \
+		CSV_CUSTOM_STAT(AlsSceneQueries, SubsystemName, Count, ECsvCustomStatOp::Accumulate); \
+		TRACE_ALS_SCENE_QUERIES(Actor, SubsystemName, Count) \
+	} while (false)
+
+#define ALS_COUNT_SCENE_QUERY(Actor, StatName, SubsystemName) ALS_COUNT_SCENE_QUERIES(Actor, StatName, SubsystemName, 1)
+
+// Counts network events of ALS characters. Totals are displayed by the "Stat Als" command, and per event counters can be
+// recorded in headless sessions (for example, a -nullrhi server with simulated clients) with the "CsvProfile Start" command.
+
+#define ALS_COUNT_NETWORK_EVENT(StatName, EventName) \
+	do \
+	{ \
+		INC_DWORD_STAT(StatName); \
+		CSV_CUSTOM_STAT(AlsNetwork, EventName, 1, ECsvCustomStatOp::Accumulate); \
+		ALS_ACCUMULATE_NETWORK_EVENT(EventName); \
+	} while (false)
+
+#define ALS_COUNT_SERVER_RPC(RpcName) ALS_COUNT_NETWORK_EVENT(STAT_Als_ServerRpcsReceived, RpcName)
+#define ALS_COUNT_CLIENT_RPC(RpcName) ALS_COUNT_NETWORK_EVENT(STAT_Als_ClientRpcsReceived, RpcName)
+
+// Multicast RPCs are counted in their implementation, which runs once on the server for each sent RPC and once more on each
+// client that receives it. Only the server side execution is counted, so that the counter matches the number of sent RPCs.
+
+#define ALS_COUNT_MULTICAST_RPC(Actor, RpcName) \
+	do \
+	{ \
+		if ((Actor)->HasAuthority() && (Actor)->GetNetMode() != NM_Standalone) \
+		{ \
+			ALS_COUNT_NETWORK_EVENT(STAT_Als_MulticastRpcsSent, RpcName); \
+		} \
+	} while (false)
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "ObjectTrace.h"
+#include "Trace/Trace.h"
+
+// Records per character ALS state into the "Als" Unreal Insights trace channel, so that it can be inspected offline in
+// the Rewind Debugger or in a trace captured from a headless session. Enable it with "-trace=default,object,als".
+
+#define ALS_TRACE_ENABLED (UE_TRACE_ENABLED && OBJECT_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+// ALS subsystems that perform scene queries. Names must match the subsystem names passed to ALS_COUNT_SCENE_QUERIES().
+
+enum class EAlsTraceSceneQuerySubsystem : uint8
+{
+	Mantling,
+	FootIk,
+	GroundPrediction,
+	Camera,
+	Footsteps,
+	Slide,
+	Prone,
+	Ragdolling,
+	Count
+};
+
+inline const TCHAR* GetAlsTraceSceneQuerySubsystemName(const EAlsTraceSceneQuerySubsystem Subsystem)
+{
+	static constexpr const TCHAR* Names[]
+	{
+		TEXT("Mantling"), TEXT("Foot Ik"), TEXT("Ground Prediction"), TEXT("Camera"),
+		TEXT("Footsteps"), TEXT("Slide"), TEXT("Prone"), TEXT("Ragdolling")
+	};
+
+	static_assert(UE_ARRAY_COUNT(Names) == static_cast<int32>(EAlsTraceSceneQuerySubsystem::Count));
+
+	return Subsystem < EAlsTraceSceneQuerySubsystem::Count ? Names[static_cast<int32>(Subsystem)] : TEXT("Unknown");
+}
+
+#if ALS_TRACE_ENABLED
+
+class AActor;
+class AAlsCharacter;
+class UAlsAnimationInstance;
+struct FAlsFeetState;
+struct FAlsLayeringState;
+
+UE_TRACE_CHANNEL_EXTERN(AlsChannel, ALS_API)
+
+struct ALS_API FAlsTrace
+{
+	static void OutputCharacterState(const AAlsCharacter& Character, int32 FloorQueriesCount);
+
+	static void OutputAnimationState(const UAlsAnimationInstance& AnimationInstance, const AAlsCharacter& Character,
+	                                 const FAlsLayeringState& LayeringState, const FAlsFeetState& FeetState);
+
+	// Can be called from any thread, since foot IK scene queries are performed on animation worker threads.
+	static void OutputSceneQueries(const AActor* Actor, EAlsTraceSceneQuerySubsystem Subsystem, int32 Count);
+};
+
+#define TRACE_ALS_CHARACTER_STATE(Character, FloorQueriesCount) \
+	FAlsTrace::OutputCharacterState(Character, FloorQueriesCount);
+
+#define TRACE_ALS_ANIMATION_STATE(AnimationInstance, Character, LayeringState, FeetState) \
+	FAlsTrace::OutputAnimationState(AnimationInstance, Character, LayeringState, FeetState);
+
+#define TRACE_ALS_SCENE_QUERIES(Actor, SubsystemName, Count) \
+	FAlsTrace::OutputSceneQueries(Actor, EAlsTraceSceneQuerySubsystem::SubsystemName, Count);
+
+#else
+
+#define TRACE_ALS_CHARACTER_STATE(Character, FloorQueriesCount)
+#define TRACE_ALS_ANIMATION_STATE(AnimationInstance, Character, LayeringState, FeetState)
+#define TRACE_ALS_SCENE_QUERIES(Actor, SubsystemName, Count)
+
+#endif
@@ -4,6 +4,7 @@
 #include "AlsUtility.generated.h"
 
 struct FBasedMovementInfo;
+class USkinnedMeshComponent;
 
 DECLARE_STATS_GROUP(TEXT("Als"), STATGROUP_Als, STATCAT_Advanced)
 
@@ -32,6 +33,11 @@ public:
 	static float GetFirstPlayerPingSeconds(const UObject* WorldContext);
 
 	static bool TryGetMovementBaseRotationSpeed(const FBasedMovementInfo& BasedMovement, FRotator& RotationSpeed);
+
+	// Returns the same transform as USkinnedMeshComponent::GetSocketTransform() with RTS_Component for the bone
+	// index of the mesh's own skinned asset, but without name lookups. Meshes using a leader pose component read
+	// the bone from the leader pose. Must be called on the game thread, since it reads the mesh pose buffers.
+	static bool TryGetComponentSpaceBoneTransform(const USkinnedMeshComponent& Mesh, int32 BoneIndex, FTransform& Transform);
 };
 
 constexpr FStringView UAlsUtility::BoolToString(const bool bValue)
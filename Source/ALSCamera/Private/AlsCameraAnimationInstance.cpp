@@ -63,3 +63,13 @@ void UAlsCameraAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 
 	bRightShoulder = Camera->IsRightShoulder();
 }
+
+void UAlsCameraAnimationInstance::NativePostEvaluateAnimation()
+{
+	Super::NativePostEvaluateAnimation();
+
+	// Called right after each evaluation of the camera mesh. If an evaluation is skipped, for example by the update
+	// rate optimizations, the curves keep their values from the last evaluation, just like the animation instance curves.
+
+	CurvesState.Refresh(GetAnimationCurveList(EAnimCurveType::AttributeCurve));
+}
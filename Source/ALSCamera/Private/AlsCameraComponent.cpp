@@ -1,15 +1,19 @@
 #include "AlsCameraComponent.h"
 
+#include "AlsCameraAnimationInstance.h"
+#include "AlsCameraPostProcessLayersBlendable.h"
 #include "AlsCameraSettings.h"
 #include "DrawDebugHelpers.h"
 #include "Animation/AnimInstance.h"
 #include "Engine/OverlapResult.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/WorldSettings.h"
+#include "SceneView.h"
 #include "Utility/AlsCameraConstants.h"
 #include "Utility/AlsDebugUtility.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsRotation.h"
+#include "Utility/AlsStats.h"
 #include "Utility/AlsUtility.h"
 #include "AlsCharacter.h"
 
@@ -37,6 +41,10 @@ void UAlsCameraComponent::OnRegister()
 {
 	Character = Cast<ACharacter>(GetOwner());
 
+	// Must be applied before the render state is created.
+
+	ApplyEvaluationMode();
+
 	Super::OnRegister();
 }
 
@@ -61,6 +69,10 @@ void UAlsCameraComponent::Activate(const bool bReset)
 
 void UAlsCameraComponent::InitAnim(const bool bForceReinitialize)
 {
+	// Must be applied before the required bones are calculated.
+
+	HideBonesForEvaluationMode();
+
 	Super::InitAnim(bForceReinitialize);
 
 	AnimationInstance = GetAnimInstance();
@@ -106,6 +118,63 @@ void UAlsCameraComponent::CompleteParallelAnimationEvaluation(const bool bDoPost
 	TickCamera(GetAnimInstance()->GetDeltaSeconds());
 }
 
+bool UAlsCameraComponent::IsEvaluatingCurvesOnly() const
+{
+	const auto* World{GetWorld()};
+
+	// Only touch the component in game worlds, so that the overridden properties don't end up saved in assets.
+
+	return EvaluationMode == EAlsCameraEvaluationMode::CurvesOnly && IsValid(World) && World->IsGameWorld();
+}
+
+void UAlsCameraComponent::ApplyEvaluationMode()
+{
+	if (!IsEvaluatingCurvesOnly())
+	{
+		return;
+	}
+
+	// The animation graph still has to be evaluated to get the curves, but the resulting
+	// pose is never rendered or used for anything else, so all follow-up work is skipped.
+
+	bRenderStatic = true;
+
+	bComponentUseFixedSkelBounds = true;
+	bSkipBoundsUpdateWhenInterpolating = true;
+
+	KinematicBonesUpdateToPhysics = EKinematicBonesUpdateToPhysics::SkipAllBones;
+	bSkipKinematicUpdateWhenInterpolating = true;
+
+	bUpdateOverlapsOnAnimationFinalize = false;
+	bPropagateCurvesToFollowers = false;
+
+	SetGenerateOverlapEvents(false);
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+}
+
+void UAlsCameraComponent::HideBonesForEvaluationMode()
+{
+	const auto* Mesh{GetSkeletalMeshAsset()};
+
+	if (!IsEvaluatingCurvesOnly() || !IsValid(Mesh))
+	{
+		return;
+	}
+
+	// Hidden bones are excluded from the required bones, so hiding all children of the root bone leaves
+	// only the root bone to be evaluated by the animation graph and filled in the component space.
+
+	const auto& ReferenceSkeleton{Mesh->GetRefSkeleton()};
+
+	for (auto i{1}; i < ReferenceSkeleton.GetNum(); i++)
+	{
+		if (ReferenceSkeleton.GetParentIndex(i) == 0 && !IsBoneHidden(i))
+		{
+			HideBone(i, PBO_None);
+		}
+	}
+}
+
 FVector UAlsCameraComponent::GetFirstPersonCameraLocation() const
 {
 	return Character->GetMesh()->GetSocketLocation(Settings->FirstPerson.CameraSocketName);
@@ -149,13 +218,69 @@ void UAlsCameraComponent::GetViewInfo(FMinimalViewInfo& ViewInfo) const
 
 	if (ViewInfo.PostProcessBlendWeight > UE_SMALL_NUMBER)
 	{
-		ViewInfo.PostProcessSettings = Settings->PostProcess;
+		Settings->PostProcessOverrides.Apply(Settings->PostProcess, ViewInfo.PostProcessSettings);
+	}
+}
+
+void UAlsCameraComponent::AddPostProcessLayersBlendable(FMinimalViewInfo& ViewInfo)
+{
+	if (!IsValid(Settings))
+	{
+		return;
+	}
+
+	const auto LayersCount{FMath::Min(PostProcessLayerWeights.Num(), Settings->PostProcessLayers.Num())};
+
+	auto bAnyLayerRelevant{false};
+
+	for (auto i{0}; i < LayersCount && !bAnyLayerRelevant; i++)
+	{
+		bAnyLayerRelevant = FAnimWeight::IsRelevant(PostProcessLayerWeights[i]);
+	}
+
+	if (!bAnyLayerRelevant)
+	{
+		return;
+	}
+
+	if (!IsValid(PostProcessLayersBlendable))
+	{
+		PostProcessLayersBlendable = NewObject<UAlsCameraPostProcessLayersBlendable>(this);
+	}
+
+	// Blendables are only applied together with the view post process settings, so these settings must have a non-zero
+	// weight. If the camera doesn't blend its own post process settings, they have no overrides and don't change anything.
+
+	if (ViewInfo.PostProcessBlendWeight <= UE_SMALL_NUMBER)
+	{
+		ViewInfo.PostProcessBlendWeight = 1.0f;
+	}
+
+	ViewInfo.PostProcessSettings.AddBlendable(TScriptInterface<IBlendableInterface>{PostProcessLayersBlendable.Get()}, 1.0f);
+}
+
+void UAlsCameraComponent::OverridePostProcessLayers(FSceneView& View) const
+{
+	if (!IsValid(Settings))
+	{
+		return;
+	}
+
+	const auto LayersCount{FMath::Min(PostProcessLayerWeights.Num(), Settings->PostProcessLayers.Num())};
+
+	for (auto i{0}; i < LayersCount; i++)
+	{
+		if (FAnimWeight::IsRelevant(PostProcessLayerWeights[i]))
+		{
+			View.OverridePostProcessSettings(Settings->PostProcessLayers[i].PostProcess, PostProcessLayerWeights[i]);
+		}
 	}
 }
 
 void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::TickCamera"), STAT_UAlsCameraComponent_TickCamera, STATGROUP_Als)
+	CSV_SCOPED_TIMING_STAT(AlsCamera, TickCamera);
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
 
 	if (!IsValid(GetAnimInstance()) || !IsValid(Settings) || !IsValid(Character))
@@ -168,6 +293,20 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 	                   TEXT(" evaluation, because accessing animation curves causes the game thread to wait")
 	                   TEXT(" for the parallel task to complete, resulting in performance degradation"));
 
+	// Take all camera curves at once from the animation instance instead of looking them up one by one below.
+
+	const auto* CameraAnimationInstance{Cast<UAlsCameraAnimationInstance>(GetAnimInstance())};
+	if (IsValid(CameraAnimationInstance))
+	{
+		CurvesState = CameraAnimationInstance->GetCurvesState();
+	}
+	else
+	{
+		CurvesState.Refresh(GetAnimInstance()->GetAnimationCurveList(EAnimCurveType::AttributeCurve));
+	}
+
+	RefreshPostProcessLayerWeights();
+
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebugCameraShapes{
 		UAlsDebugUtility::ShouldDisplayDebugForActor(GetOwner(), UAlsCameraConstants::CameraShapesDebugDisplayName())
@@ -215,11 +354,7 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 
 	PivotTargetLocation = GetThirdPersonPivotLocation();
 
-	const auto FirstPersonOverride{
-		UAlsMath::Clamp01(GetAnimInstance()->GetCurveValue(UAlsCameraConstants::FirstPersonOverrideCurveName()))
-	};
-
-	if (FAnimWeight::IsFullWeight(FirstPersonOverride))
+	if (FAnimWeight::IsFullWeight(CurvesState.FirstPersonOverride))
 	{
 		// Skip other calculations if the character is fully in first-person mode.
 
@@ -314,15 +449,16 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 
 	const auto CameraFinalLocation{CalculateCameraTrace(CameraTargetLocation, PivotOffset, DeltaTime, bAllowLag, TraceDistanceRatio)};
 
-	if (!FAnimWeight::IsRelevant(FirstPersonOverride))
+	if (!FAnimWeight::IsRelevant(CurvesState.FirstPersonOverride))
 	{
 		CameraLocation = CameraFinalLocation;
 		CameraFieldOfView = Settings->ThirdPerson.FieldOfView;
 	}
 	else
 	{
-		CameraLocation = FMath::Lerp(CameraFinalLocation, GetFirstPersonCameraLocation(), FirstPersonOverride);
-		CameraFieldOfView = FMath::Lerp(Settings->ThirdPerson.FieldOfView, Settings->FirstPerson.FieldOfView, FirstPersonOverride);
+		CameraLocation = FMath::Lerp(CameraFinalLocation, GetFirstPersonCameraLocation(), CurvesState.FirstPersonOverride);
+		CameraFieldOfView = FMath::Lerp(Settings->ThirdPerson.FieldOfView, Settings->FirstPerson.FieldOfView,
+		                                 CurvesState.FirstPersonOverride);
 	}
 
 	if (bOverrideFieldOfView)
@@ -333,16 +469,37 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 	CameraFieldOfView = FMath::Clamp(CameraFieldOfView + CalculateFovOffset(), 5.0f, 175.0f);
 }
 
+void UAlsCameraComponent::RefreshPostProcessLayerWeights()
+{
+	const auto& Layers{Settings->PostProcessLayers};
+
+	PostProcessLayerWeights.SetNumUninitialized(Layers.Num());
+
+	if (Layers.IsEmpty())
+	{
+		return;
+	}
+
+	const auto& Curves{GetAnimInstance()->GetAnimationCurveList(EAnimCurveType::AttributeCurve)};
+
+	for (auto i{0}; i < Layers.Num(); i++)
+	{
+		const auto* Weight{Curves.Find(Layers[i].WeightCurveName)};
+
+		PostProcessLayerWeights[i] = Weight != nullptr ? UAlsMath::Clamp01(*Weight) : 0.0f;
+	}
+}
+
 FRotator UAlsCameraComponent::CalculateCameraRotation(const FRotator& CameraTargetRotation,
                                                       const float DeltaTime, const bool bAllowLag) const
 {
+	ALS_SCOPED_STAGE_STAT(AlsCamera, CalculateCameraRotation)
+
 	FRotator NewRotation = CameraTargetRotation;
 	if (bAllowLag)
 	{
-		const auto RotationLag = GetAnimInstance()->GetCurveValue(
-			UAlsCameraConstants::RotationLagCurveName());
 		NewRotation = UAlsRotation::DamperExactRotation(
-			CameraRotation, CameraTargetRotation, DeltaTime, RotationLag);
+			CameraRotation, CameraTargetRotation, DeltaTime, CurvesState.RotationLag);
 	}
 
 	return NewRotation;
@@ -350,6 +507,8 @@ FRotator UAlsCameraComponent::CalculateCameraRotation(const FRotator& CameraTarg
 
 FVector UAlsCameraComponent::CalculatePivotLagLocation(const FQuat& CameraYawRotation, const float DeltaTime, const bool bAllowLag) const
 {
+	ALS_SCOPED_STAGE_STAT(AlsCamera, CalculatePivotLagLocation)
+
 	if (!bAllowLag)
 	{
 		return PivotTargetLocation;
@@ -358,45 +517,36 @@ FVector UAlsCameraComponent::CalculatePivotLagLocation(const FQuat& CameraYawRot
 	const auto RelativePivotInitialLagLocation{CameraYawRotation.UnrotateVector(PivotLagLocation)};
 	const auto RelativePivotTargetLocation{CameraYawRotation.UnrotateVector(PivotTargetLocation)};
 
-	const auto LocationLagX{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagXCurveName())};
-	const auto LocationLagY{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagYCurveName())};
-	const auto LocationLagZ{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagZCurveName())};
+	const auto& LocationLag{CurvesState.LocationLag};
 
 	return CameraYawRotation.RotateVector({
-		UAlsMath::DamperExact(RelativePivotInitialLagLocation.X, RelativePivotTargetLocation.X, DeltaTime, LocationLagX),
-		UAlsMath::DamperExact(RelativePivotInitialLagLocation.Y, RelativePivotTargetLocation.Y, DeltaTime, LocationLagY),
-		UAlsMath::DamperExact(RelativePivotInitialLagLocation.Z, RelativePivotTargetLocation.Z, DeltaTime, LocationLagZ)
+		UAlsMath::DamperExact(RelativePivotInitialLagLocation.X, RelativePivotTargetLocation.X, DeltaTime, LocationLag.X),
+		UAlsMath::DamperExact(RelativePivotInitialLagLocation.Y, RelativePivotTargetLocation.Y, DeltaTime, LocationLag.Y),
+		UAlsMath::DamperExact(RelativePivotInitialLagLocation.Z, RelativePivotTargetLocation.Z, DeltaTime, LocationLag.Z)
 	});
 }
 
 FVector UAlsCameraComponent::CalculatePivotOffset() const
 {
 	return Character->GetMesh()->GetComponentQuat().RotateVector(
-		FVector{
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetXCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetYCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetZCurveName())
-		} * Character->GetMesh()->GetComponentScale().Z);
+		FVector{CurvesState.PivotOffset} * Character->GetMesh()->GetComponentScale().Z);
 }
 
 FVector UAlsCameraComponent::CalculateCameraOffset() const
 {
-	return CameraRotation.RotateVector(
-		FVector{
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetXCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetYCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetZCurveName())
-		} * Character->GetMesh()->GetComponentScale().Z);
+	return CameraRotation.RotateVector(FVector{CurvesState.CameraOffset} * Character->GetMesh()->GetComponentScale().Z);
 }
 
 float UAlsCameraComponent::CalculateFovOffset() const
 {
-	return GetAnimInstance()->GetCurveValue(UAlsCameraConstants::FovOffsetCurveName());
+	return CurvesState.FovOffset;
 }
 
 FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLocation, const FVector& PivotOffset,
                                                   const float DeltaTime, const bool bAllowLag, float& NewTraceDistanceRatio) const
 {
+	ALS_SCOPED_STAGE_STAT(AlsCamera, CalculateCameraTrace)
+
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebugCameraTraces{
 		UAlsDebugUtility::ShouldDisplayDebugForActor(GetOwner(), UAlsCameraConstants::CameraTracesDebugDisplayName())
@@ -413,7 +563,7 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 		FMath::Lerp(
 			GetThirdPersonTraceStartLocation(),
 			PivotTargetLocation + PivotOffset + FVector{Settings->ThirdPerson.TraceOverrideOffset},
-			UAlsMath::Clamp01(GetAnimInstance()->GetCurveValue(UAlsCameraConstants::TraceOverrideCurveName())))
+			CurvesState.TraceOverride)
 	};
 
 	const auto TraceEnd{CameraTargetLocation};
@@ -421,6 +571,8 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 
 	auto TraceResult{TraceEnd};
 
+	ALS_COUNT_SCENE_QUERY(GetOwner(), STAT_Als_CameraSceneQueries, Camera);
+
 	FHitResult Hit;
 	if (GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
 	                                     CollisionShape, {MainTraceTag, false, GetOwner()}))
@@ -433,6 +585,8 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 		{
 			static const FName AdjustedTraceTag{FString::Printf(TEXT("%hs (Adjusted Trace)"), __FUNCTION__)};
 
+			ALS_COUNT_SCENE_QUERY(GetOwner(), STAT_Als_CameraSceneQueries, Camera);
+
 			GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
 			                                 CollisionShape, {AdjustedTraceTag, false, GetOwner()});
 			if (Hit.IsValidBlockingHit())
@@ -484,6 +638,8 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 
 bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location, const bool bDisplayDebugCameraTraces) const
 {
+	ALS_SCOPED_STAGE_STAT(AlsCamera, TryAdjustLocationBlockedByGeometry)
+
 	// Based on ComponentEncroachesBlockingGeometry_WithAdjustment().
 
 	const auto MeshScale{UE_REAL_TO_FLOAT(Character->GetMesh()->GetComponentScale().Z)};
@@ -499,6 +655,8 @@ bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location,
 
 	static const FName OverlapMultiTraceTag{FString::Printf(TEXT("%hs (Overlap Multi)"), __FUNCTION__)};
 
+	ALS_COUNT_SCENE_QUERY(GetOwner(), STAT_Als_CameraSceneQueries, Camera);
+
 	if (!GetWorld()->OverlapMultiByChannel(Overlaps, Location, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
 	                                       CollisionShape, {OverlapMultiTraceTag, false, GetOwner()}))
 	{
@@ -558,6 +716,8 @@ bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location,
 
 	static const FName FreeSpaceTraceTag{FString::Printf(TEXT("%hs (Free Space Overlap)"), __FUNCTION__)};
 
+	ALS_COUNT_SCENE_QUERY(GetOwner(), STAT_Als_CameraSceneQueries, Camera);
+
 	return !GetWorld()->OverlapBlockingTestByChannel(Location, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
 	                                                 FCollisionShape::MakeSphere(Settings->ThirdPerson.TraceRadius * MeshScale),
 	                                                 {FreeSpaceTraceTag, false, GetOwner()});
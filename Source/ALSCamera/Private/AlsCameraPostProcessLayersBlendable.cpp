@@ -0,0 +1,12 @@
+#include "AlsCameraPostProcessLayersBlendable.h"
+
+#include "AlsCameraComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCameraPostProcessLayersBlendable)
+
+void UAlsCameraPostProcessLayersBlendable::OverrideBlendableSettings(FSceneView& View, const float Weight) const
+{
+	// The weight is the blend weight of the camera's own post process settings, which the layers don't depend on.
+
+	GetOuterUAlsCameraComponent()->OverridePostProcessLayers(View);
+}
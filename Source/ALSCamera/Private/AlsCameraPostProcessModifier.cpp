@@ -0,0 +1,20 @@
+#include "AlsCameraPostProcessModifier.h"
+
+#include "AlsCameraComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCameraPostProcessModifier)
+
+bool UAlsCameraPostProcessModifier::ModifyCamera(const float DeltaTime, FMinimalViewInfo& ViewInfo)
+{
+	const auto bStopModifiers{Super::ModifyCamera(DeltaTime, ViewInfo)};
+
+	const auto* ViewTarget{GetViewTarget()};
+	auto* Camera{IsValid(ViewTarget) ? ViewTarget->FindComponentByClass<UAlsCameraComponent>() : nullptr};
+
+	if (IsValid(Camera) && Camera->IsActive())
+	{
+		Camera->AddPostProcessLayersBlendable(ViewInfo);
+	}
+
+	return bStopModifiers;
+}
@@ -13,3 +13,40 @@ void UAlsCameraSettings::Serialize(FArchive& Archive)
 	}
 }
 #endif
+
+void UAlsCameraSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// Settings that are created at runtime or in the editor are never loaded, so the overrides must also be refreshed here.
+
+	PostProcessOverrides.Refresh(PostProcess);
+}
+
+void UAlsCameraSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	PostProcessOverrides.Refresh(PostProcess);
+}
+
+#if WITH_EDITOR
+void UAlsCameraSettings::PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent)
+{
+	if (ChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_STRING_VIEW_CHECKED(ThisClass, PostProcess))
+	{
+		PostProcessOverrides.Refresh(PostProcess);
+	}
+
+	Super::PostEditChangeProperty(ChangedEvent);
+}
+
+void UAlsCameraSettings::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	// Undo restores the post process settings without notifying about property changes.
+
+	PostProcessOverrides.Refresh(PostProcess);
+}
+#endif
@@ -0,0 +1,36 @@
+#include "State/AlsCameraCurvesState.h"
+
+#include "Utility/AlsCameraConstants.h"
+#include "Utility/AlsMath.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCameraCurvesState)
+
+void FAlsCameraCurvesState::Refresh(const TMap<FName, float>& Curves)
+{
+	static const auto GetCurveValue{
+		[](const TMap<FName, float>& Curves, const FName& CurveName) -> float
+		{
+			const auto* Value{Curves.Find(CurveName)};
+
+			return Value != nullptr ? *Value : 0.0f;
+		}
+	};
+
+	PivotOffset.X = GetCurveValue(Curves, UAlsCameraConstants::PivotOffsetXCurveName());
+	PivotOffset.Y = GetCurveValue(Curves, UAlsCameraConstants::PivotOffsetYCurveName());
+	PivotOffset.Z = GetCurveValue(Curves, UAlsCameraConstants::PivotOffsetZCurveName());
+
+	CameraOffset.X = GetCurveValue(Curves, UAlsCameraConstants::CameraOffsetXCurveName());
+	CameraOffset.Y = GetCurveValue(Curves, UAlsCameraConstants::CameraOffsetYCurveName());
+	CameraOffset.Z = GetCurveValue(Curves, UAlsCameraConstants::CameraOffsetZCurveName());
+
+	LocationLag.X = GetCurveValue(Curves, UAlsCameraConstants::LocationLagXCurveName());
+	LocationLag.Y = GetCurveValue(Curves, UAlsCameraConstants::LocationLagYCurveName());
+	LocationLag.Z = GetCurveValue(Curves, UAlsCameraConstants::LocationLagZCurveName());
+
+	RotationLag = GetCurveValue(Curves, UAlsCameraConstants::RotationLagCurveName());
+	FovOffset = GetCurveValue(Curves, UAlsCameraConstants::FovOffsetCurveName());
+
+	FirstPersonOverride = UAlsMath::Clamp01(GetCurveValue(Curves, UAlsCameraConstants::FirstPersonOverrideCurveName()));
+	TraceOverride = UAlsMath::Clamp01(GetCurveValue(Curves, UAlsCameraConstants::TraceOverrideCurveName()));
+}
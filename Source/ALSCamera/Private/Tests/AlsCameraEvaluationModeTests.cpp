@@ -0,0 +1,206 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AlsCameraAnimationInstance.h"
+#include "AlsCameraComponent.h"
+#include "AlsCharacter.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Utility/AlsCameraConstants.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsPrivateMemberAccessor.h"
+
+// The stance and gait are normally derived from the character movement, so they are set directly
+// to get the camera animation graph into the corresponding states without simulating the movement.
+
+ALS_DEFINE_PRIVATE_MEMBER_ACCESSOR(AlsSetStanceAccessor, &AAlsCharacter::SetStance, void (AAlsCharacter::*)(const FGameplayTag&))
+
+ALS_DEFINE_PRIVATE_MEMBER_ACCESSOR(AlsSetGaitAccessor, &AAlsCharacter::SetGait, void (AAlsCharacter::*)(const FGameplayTag&))
+
+namespace AlsCameraEvaluationModeTests
+{
+	static const auto* CameraComponentClassPath{TEXT("/ALS/ALSCamera/B_Als_CameraComponent.B_Als_CameraComponent_C")};
+
+	static const auto* CharacterClassPath{TEXT("/ALS/ALSManny/Characters/B_AlsManny_Character.B_AlsManny_Character_C")};
+
+	static EAlsCameraEvaluationMode& GetEvaluationMode(UAlsCameraComponent& Camera)
+	{
+		const auto* Property{FindFProperty<FProperty>(UAlsCameraComponent::StaticClass(), TEXT("EvaluationMode"))};
+		check(Property != nullptr)
+
+		return *Property->ContainerPtrToValuePtr<EAlsCameraEvaluationMode>(&Camera);
+	}
+
+	static UAlsCameraComponent* CreateCamera(AAlsCharacter& Character, UClass& CameraClass, const EAlsCameraEvaluationMode EvaluationMode)
+	{
+		auto* Camera{NewObject<UAlsCameraComponent>(&Character, &CameraClass)};
+
+		// The evaluation mode is applied when the component is registered.
+
+		GetEvaluationMode(*Camera) = EvaluationMode;
+
+		Camera->SetupAttachment(Character.GetMesh());
+		Camera->RegisterComponent();
+
+		return Camera;
+	}
+
+	static void EvaluateCamera(UAlsCameraComponent& Camera, const float DeltaTime)
+	{
+		Camera.TickAnimation(DeltaTime, false);
+		Camera.RefreshBoneTransforms();
+		Camera.FinalizeBoneTransform();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsCameraEvaluationModeDefaultTest, "Als.Camera.EvaluationMode.DefaultsToFull",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsCameraEvaluationModeDefaultTest::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("Evaluation mode defaults to full"),
+	          AlsCameraEvaluationModeTests::GetEvaluationMode(*GetMutableDefault<UAlsCameraComponent>()),
+	          EAlsCameraEvaluationMode::Full);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsCameraEvaluationModeCurveParityTest, "Als.Camera.EvaluationMode.CurveParity",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsCameraEvaluationModeCurveParityTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsCameraEvaluationModeTests;
+
+	auto* CameraClass{LoadClass<UAlsCameraComponent>(nullptr, CameraComponentClassPath)};
+	const TSubclassOf<AAlsCharacter> CharacterClass{LoadClass<AAlsCharacter>(nullptr, CharacterClassPath)};
+
+	if (!TestNotNull(TEXT("Camera component class is loaded"), CameraClass) ||
+	    !TestNotNull(TEXT("Character class is loaded"), CharacterClass.Get()))
+	{
+		return false;
+	}
+
+	auto* World{UWorld::CreateWorld(EWorldType::Game, false)};
+	GEngine->CreateNewWorldContext(EWorldType::Game).SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL{});
+	World->GetWorldSettings()->NotifyBeginPlay();
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	auto* Character{World->SpawnActor<AAlsCharacter>(CharacterClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnParameters)};
+
+	if (TestNotNull(TEXT("Character is spawned"), Character))
+	{
+		auto* FullCamera{CreateCamera(*Character, *CameraClass, EAlsCameraEvaluationMode::Full)};
+		auto* CurvesOnlyCamera{CreateCamera(*Character, *CameraClass, EAlsCameraEvaluationMode::CurvesOnly)};
+
+		auto* FullAnimationInstance{Cast<UAlsCameraAnimationInstance>(FullCamera->GetAnimInstance())};
+		auto* CurvesOnlyAnimationInstance{Cast<UAlsCameraAnimationInstance>(CurvesOnlyCamera->GetAnimInstance())};
+
+		if (TestNotNull(TEXT("Full mode animation instance exists"), FullAnimationInstance) &&
+		    TestNotNull(TEXT("Curves only mode animation instance exists"), CurvesOnlyAnimationInstance))
+		{
+			const auto FullBonesCount{FullAnimationInstance->GetRequiredBones().GetBoneIndicesArray().Num()};
+			const auto CurvesOnlyBonesCount{CurvesOnlyAnimationInstance->GetRequiredBones().GetBoneIndicesArray().Num()};
+
+			AddInfo(FString::Printf(TEXT("Required bones: %d in the full mode, %d in the curves only mode."),
+			                        FullBonesCount, CurvesOnlyBonesCount));
+
+			TestEqual(TEXT("Only the root bone is evaluated in the curves only mode"), CurvesOnlyBonesCount, 1);
+
+			const FName CurveNames[]
+			{
+				UAlsCameraConstants::PivotOffsetXCurveName(),
+				UAlsCameraConstants::PivotOffsetYCurveName(),
+				UAlsCameraConstants::PivotOffsetZCurveName(),
+				UAlsCameraConstants::CameraOffsetXCurveName(),
+				UAlsCameraConstants::CameraOffsetYCurveName(),
+				UAlsCameraConstants::CameraOffsetZCurveName(),
+				UAlsCameraConstants::LocationLagXCurveName(),
+				UAlsCameraConstants::LocationLagYCurveName(),
+				UAlsCameraConstants::LocationLagZCurveName(),
+				UAlsCameraConstants::RotationLagCurveName(),
+				UAlsCameraConstants::FovOffsetCurveName(),
+				UAlsCameraConstants::FirstPersonOverrideCurveName(),
+				UAlsCameraConstants::TraceOverrideCurveName()
+			};
+
+			const FGameplayTag ViewModes[]{AlsViewModeTags::ThirdPerson, AlsViewModeTags::FirstPerson};
+			const FGameplayTag Stances[]{AlsStanceTags::Standing, AlsStanceTags::Crouching};
+			const FGameplayTag Gaits[]{AlsGaitTags::Walking, AlsGaitTags::Running, AlsGaitTags::Sprinting};
+
+			static constexpr auto DeltaTime{1.0f / 30.0f};
+			static constexpr auto FramesCount{10};
+
+			for (const auto& ViewMode : ViewModes)
+			{
+				for (const auto& Stance : Stances)
+				{
+					for (const auto& Gait : Gaits)
+					{
+						Character->SetViewMode(ViewMode);
+						AlsSetStanceAccessor::Access(Character, Stance);
+						AlsSetGaitAccessor::Access(Character, Gait);
+
+						const auto StateDescription{
+							FString::Printf(TEXT("%s, %s, %s"), *ViewMode.ToString(), *Stance.ToString(), *Gait.ToString())
+						};
+
+						// Evaluate several frames in each state, so that the camera animation graph blends into it.
+
+						for (auto Frame{0}; Frame < FramesCount; Frame++)
+						{
+							EvaluateCamera(*FullCamera, DeltaTime);
+							EvaluateCamera(*CurvesOnlyCamera, DeltaTime);
+
+							for (const auto& CurveName : CurveNames)
+							{
+								TestEqual(FString::Printf(TEXT("%s, frame %d: %s curve matches"),
+								                          *StateDescription, Frame, *CurveName.ToString()),
+								          CurvesOnlyAnimationInstance->GetCurveValue(CurveName),
+								          FullAnimationInstance->GetCurveValue(CurveName), UE_KINDA_SMALL_NUMBER);
+							}
+
+							// The curves snapshot must match the curves that would be looked up one by one.
+
+							FAlsCameraCurvesState ExpectedCurvesState;
+							ExpectedCurvesState.Refresh(FullAnimationInstance->GetAnimationCurveList(EAnimCurveType::AttributeCurve));
+
+							for (const auto* AnimationInstance : {FullAnimationInstance, CurvesOnlyAnimationInstance})
+							{
+								const auto& CurvesState{AnimationInstance->GetCurvesState()};
+								const auto* Description{AnimationInstance == FullAnimationInstance ? TEXT("Full") : TEXT("Curves only")};
+
+								TestTrue(FString::Printf(TEXT("%s, frame %d: %s mode curves snapshot matches"),
+								                         *StateDescription, Frame, Description),
+								         CurvesState.PivotOffset.Equals(ExpectedCurvesState.PivotOffset, UE_KINDA_SMALL_NUMBER) &&
+								         CurvesState.CameraOffset.Equals(ExpectedCurvesState.CameraOffset, UE_KINDA_SMALL_NUMBER) &&
+								         CurvesState.LocationLag.Equals(ExpectedCurvesState.LocationLag, UE_KINDA_SMALL_NUMBER) &&
+								         FMath::IsNearlyEqual(CurvesState.RotationLag, ExpectedCurvesState.RotationLag,
+								                              UE_KINDA_SMALL_NUMBER) &&
+								         FMath::IsNearlyEqual(CurvesState.FovOffset, ExpectedCurvesState.FovOffset, UE_KINDA_SMALL_NUMBER) &&
+								         FMath::IsNearlyEqual(CurvesState.FirstPersonOverride, ExpectedCurvesState.FirstPersonOverride,
+								                              UE_KINDA_SMALL_NUMBER) &&
+								         FMath::IsNearlyEqual(CurvesState.TraceOverride, ExpectedCurvesState.TraceOverride,
+								                              UE_KINDA_SMALL_NUMBER));
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif
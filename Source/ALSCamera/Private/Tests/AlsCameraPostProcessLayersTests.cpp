@@ -0,0 +1,88 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AlsCameraComponent.h"
+#include "AlsCameraSettings.h"
+#include "SceneView.h"
+#include "UObject/Package.h"
+
+namespace AlsCameraPostProcessLayersTests
+{
+	template <typename ValueType>
+	static ValueType& GetPropertyValue(UAlsCameraComponent& Camera, const TCHAR* PropertyName)
+	{
+		const auto* Property{FindFProperty<FProperty>(UAlsCameraComponent::StaticClass(), PropertyName)};
+		check(Property != nullptr)
+
+		return *Property->ContainerPtrToValuePtr<ValueType>(&Camera);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsCameraPostProcessLayersBlendTest, "Als.Camera.PostProcessLayers.Blend",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsCameraPostProcessLayersBlendTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsCameraPostProcessLayersTests;
+
+	static constexpr auto LayerBloomIntensity{4.0f};
+	static constexpr auto LayerWeight{0.25f};
+
+	auto* Settings{NewObject<UAlsCameraSettings>(GetTransientPackage())};
+
+	auto& Layer{Settings->PostProcessLayers.AddDefaulted_GetRef()};
+	Layer.PostProcess.bOverride_BloomIntensity = true;
+	Layer.PostProcess.BloomIntensity = LayerBloomIntensity;
+
+	auto* Camera{NewObject<UAlsCameraComponent>(GetTransientPackage())};
+	GetPropertyValue<TObjectPtr<UAlsCameraSettings>>(*Camera, TEXT("Settings")) = Settings;
+
+	auto& LayerWeights{GetPropertyValue<TArray<float>>(*Camera, TEXT("PostProcessLayerWeights"))};
+
+	// Irrelevant layers must not add anything to the view.
+
+	LayerWeights = {0.0f};
+
+	FMinimalViewInfo ViewInfo;
+	Camera->AddPostProcessLayersBlendable(ViewInfo);
+
+	TestEqual(TEXT("No blendable is added for irrelevant layers"), ViewInfo.PostProcessSettings.WeightedBlendables.Array.Num(), 0);
+
+	LayerWeights = {LayerWeight};
+
+	Camera->AddPostProcessLayersBlendable(ViewInfo);
+
+	TestEqual(TEXT("Blendable is added for relevant layers"), ViewInfo.PostProcessSettings.WeightedBlendables.Array.Num(), 1);
+	TestEqual(TEXT("View post process settings are applied"), ViewInfo.PostProcessBlendWeight, 1.0f);
+
+	// Blend the view post process settings the same way the engine does when it calculates the scene view.
+
+	FSceneViewFamily ViewFamily{
+		FSceneViewFamily::ConstructionValues{nullptr, nullptr, FEngineShowFlags{ESFIM_Game}}.SetTime(FGameTime{})
+	};
+
+	FSceneViewInitOptions ViewInitOptions;
+	ViewInitOptions.ViewFamily = &ViewFamily;
+	ViewInitOptions.SetViewRectangle({0, 0, 64, 64});
+	ViewInitOptions.ViewOrigin = FVector::ZeroVector;
+	ViewInitOptions.ViewRotationMatrix = FMatrix::Identity;
+	ViewInitOptions.ProjectionMatrix = FReversedZPerspectiveMatrix{UE_HALF_PI * 0.5f, 1.0f, 1.0f, 10.0f};
+
+	FSceneView View{ViewInitOptions};
+
+	const auto DefaultBloomIntensity{View.FinalPostProcessSettings.BloomIntensity};
+	const auto DefaultBloomThreshold{View.FinalPostProcessSettings.BloomThreshold};
+
+	View.OverridePostProcessSettings(ViewInfo.PostProcessSettings, ViewInfo.PostProcessBlendWeight);
+
+	TestEqual(TEXT("Overridden property is blended with the layer weight"), View.FinalPostProcessSettings.BloomIntensity,
+	          FMath::Lerp(DefaultBloomIntensity, LayerBloomIntensity, LayerWeight), UE_KINDA_SMALL_NUMBER);
+
+	TestEqual(TEXT("Not overridden property is not changed"), View.FinalPostProcessSettings.BloomThreshold,
+	          DefaultBloomThreshold, UE_KINDA_SMALL_NUMBER);
+
+	return true;
+}
+
+#endif
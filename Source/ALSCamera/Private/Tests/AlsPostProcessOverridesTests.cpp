@@ -0,0 +1,31 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AlsCameraSettings.h"
+#include "UObject/Package.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsPostProcessOverridesNewObjectTest, "Als.Camera.PostProcessOverrides.NewObject",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsPostProcessOverridesNewObjectTest::RunTest(const FString& Parameters)
+{
+	auto* Template{NewObject<UAlsCameraSettings>(GetTransientPackage())};
+	Template->PostProcess.bOverride_BloomIntensity = true;
+	Template->PostProcess.BloomIntensity = 2.5f;
+
+	// Settings created at runtime are never loaded, so their overrides must be built when their properties are initialized.
+
+	const auto* Settings{NewObject<UAlsCameraSettings>(GetTransientPackage(), NAME_None, RF_Transient, Template)};
+
+	FPostProcessSettings PostProcess;
+	Settings->PostProcessOverrides.Apply(Settings->PostProcess, PostProcess);
+
+	TestTrue(TEXT("Override flag is applied"), static_cast<bool>(PostProcess.bOverride_BloomIntensity));
+	TestEqual(TEXT("Overridden value is applied"), PostProcess.BloomIntensity, 2.5f);
+	TestFalse(TEXT("Other override flags are not applied"), static_cast<bool>(PostProcess.bOverride_BloomThreshold));
+
+	return true;
+}
+
+#endif
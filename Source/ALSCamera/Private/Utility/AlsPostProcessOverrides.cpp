@@ -0,0 +1,55 @@
+#include "Utility/AlsPostProcessOverrides.h"
+
+void FAlsPostProcessOverrides::Refresh(const FPostProcessSettings& Settings)
+{
+	static const FString OverridePrefix{TEXTVIEW("bOverride_")};
+
+	Properties.Reset();
+
+	bCopyWeightedBlendables = !Settings.WeightedBlendables.Array.IsEmpty();
+	bCopyAllProperties = false;
+
+	const auto* Struct{FPostProcessSettings::StaticStruct()};
+
+	for (TFieldIterator<FBoolProperty> Iterator{Struct}; Iterator; ++Iterator)
+	{
+		const auto* OverrideProperty{*Iterator};
+		const auto OverridePropertyName{OverrideProperty->GetName()};
+
+		if (!OverridePropertyName.StartsWith(OverridePrefix, ESearchCase::CaseSensitive) ||
+		    !OverrideProperty->GetPropertyValue_InContainer(&Settings))
+		{
+			continue;
+		}
+
+		const auto* ValueProperty{Struct->FindPropertyByName(FName{OverridePropertyName.RightChop(OverridePrefix.Len())})};
+		if (ValueProperty == nullptr)
+		{
+			Properties.Reset();
+			bCopyAllProperties = true;
+			return;
+		}
+
+		Properties.Emplace(OverrideProperty, ValueProperty);
+	}
+}
+
+void FAlsPostProcessOverrides::Apply(const FPostProcessSettings& Source, FPostProcessSettings& Target) const
+{
+	if (bCopyAllProperties)
+	{
+		Target = Source;
+		return;
+	}
+
+	for (const auto& [OverrideProperty, ValueProperty] : Properties)
+	{
+		OverrideProperty->SetPropertyValue_InContainer(&Target, true);
+		ValueProperty->CopyCompleteValue_InContainer(&Target, &Source);
+	}
+
+	if (bCopyWeightedBlendables)
+	{
+		Target.WeightedBlendables = Source.WeightedBlendables;
+	}
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Animation/AnimInstance.h"
+#include "State/AlsCameraCurvesState.h"
 #include "Utility/AlsGameplayTags.h"
 #include "AlsCameraAnimationInstance.generated.h"
 
@@ -40,8 +41,20 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bRightShoulder : 1 {true};
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsCameraCurvesState CurvesState;
+
 public:
 	virtual void NativeInitializeAnimation() override;
 
 	virtual void NativeUpdateAnimation(float DeltaTime) override;
+
+	virtual void NativePostEvaluateAnimation() override;
+
+	const FAlsCameraCurvesState& GetCurvesState() const;
 };
+
+inline const FAlsCameraCurvesState& UAlsCameraAnimationInstance::GetCurvesState() const
+{
+	return CurvesState;
+}
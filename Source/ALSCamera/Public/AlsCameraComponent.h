@@ -1,11 +1,26 @@
 #pragma once
 
 #include "Components/SkeletalMeshComponent.h"
+#include "State/AlsCameraCurvesState.h"
 #include "Utility/AlsMath.h"
 #include "AlsCameraComponent.generated.h"
 
 class UAlsCameraSettings;
+class UAlsCameraPostProcessLayersBlendable;
 class ACharacter;
+class FSceneView;
+
+UENUM(BlueprintType)
+enum class EAlsCameraEvaluationMode : uint8
+{
+	// The camera mesh is updated like any other skeletal mesh.
+	Full,
+
+	// Only the animation curves of the camera mesh are used to calculate the camera, so only its root bone is evaluated,
+	// and everything that is only needed to render the camera mesh, use its bones in physics and collision, or calculate
+	// its bounds is skipped. Curves linked to other bones of the camera skeleton are filtered out in this mode.
+	CurvesOnly
+};
 
 UCLASS(ClassGroup = "ALS", Meta = (BlueprintSpawnableComponent),
 	HideCategories = ("ComponentTick", "Clothing", "Physics", "MasterPoseComponent", "Collision", "AnimationRig",
@@ -29,6 +44,11 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ClampMax = 1))
 	float PostProcessWeight{0.0f};
 
+	// The curves only evaluation mode can be used to reduce the cost of the camera
+	// mesh if nothing uses its bones, for example if nothing is attached to them.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	EAlsCameraEvaluationMode EvaluationMode{EAlsCameraEvaluationMode::Full};
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	TObjectPtr<ACharacter> Character;
 
@@ -38,6 +58,15 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ForceUnits = "x"))
 	float PreviousGlobalTimeDilation{1.0f};
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsCameraCurvesState CurvesState;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TArray<float> PostProcessLayerWeights;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UAlsCameraPostProcessLayersBlendable> PostProcessLayersBlendable;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FVector PivotTargetLocation{ForceInit};
 
@@ -93,6 +122,13 @@ public:
 
 	virtual void CompleteParallelAnimationEvaluation(bool bDoPostAnimationEvaluation) override;
 
+private:
+	bool IsEvaluatingCurvesOnly() const;
+
+	void ApplyEvaluationMode();
+
+	void HideBonesForEvaluationMode();
+
 public:
 	bool IsFieldOfViewOverriden() const;
 
@@ -126,9 +162,15 @@ public:
 	UFUNCTION(BlueprintPure, Category = "ALS|Camera")
 	virtual void GetViewInfo(FMinimalViewInfo& ViewInfo) const;
 
+	void AddPostProcessLayersBlendable(FMinimalViewInfo& ViewInfo);
+
+	void OverridePostProcessLayers(FSceneView& View) const;
+
 protected:
 	virtual void TickCamera(float DeltaTime, bool bAllowLag = true);
 
+	void RefreshPostProcessLayerWeights();
+
 	FRotator CalculateCameraRotation(const FRotator& CameraTargetRotation, float DeltaTime, bool bAllowLag) const;
 
 	FVector CalculatePivotLagLocation(const FQuat& CameraYawRotation, float DeltaTime, bool bAllowLag) const;
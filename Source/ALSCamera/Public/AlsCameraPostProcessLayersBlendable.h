@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Engine/BlendableInterface.h"
+#include "AlsCameraPostProcessLayersBlendable.generated.h"
+
+class UAlsCameraComponent;
+
+// Blends the post process layers of the owning ALS camera directly into the scene view, so that the layer post
+// process settings, which are several kilobytes in size, are not copied every frame. The engine blends only the
+// properties enabled by the override flags of each layer. Added to the view by UAlsCameraPostProcessModifier.
+UCLASS(Transient, Within = AlsCameraComponent)
+class ALSCAMERA_API UAlsCameraPostProcessLayersBlendable : public UObject, public IBlendableInterface
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OverrideBlendableSettings(FSceneView& View, float Weight) const override;
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Camera/CameraModifier.h"
+#include "AlsCameraPostProcessModifier.generated.h"
+
+// Blends the post process layers of the ALS camera of the current view target, see UAlsCameraSettings::PostProcessLayers.
+// Add this modifier to the default modifiers of the player camera manager to enable post process layers.
+UCLASS(DisplayName = "Als Camera Post Process Modifier")
+class ALSCAMERA_API UAlsCameraPostProcessModifier : public UCameraModifier
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ModifyCamera(float DeltaTime, FMinimalViewInfo& ViewInfo) override;
+};
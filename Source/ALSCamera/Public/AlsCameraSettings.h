@@ -3,6 +3,7 @@
 #include "Engine/DataAsset.h"
 #include "Engine/Scene.h"
 #include "Utility/AlsConstants.h"
+#include "Utility/AlsPostProcessOverrides.h"
 #include "GameplayTagContainer.h"
 #include "AlsCameraSettings.generated.h"
 
@@ -65,6 +66,19 @@ struct ALSCAMERA_API FAlsThirdPersonCameraSettings
 	FAlsTraceDistanceSmoothingSettings TraceDistanceSmoothing;
 };
 
+USTRUCT(BlueprintType)
+struct ALSCAMERA_API FAlsCameraPostProcessLayerSettings
+{
+	GENERATED_BODY()
+
+	// Animation curve of the camera animation instance that is used as the blend weight of this layer.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FName WeightCurveName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FPostProcessSettings PostProcess;
+};
+
 UCLASS(Blueprintable, BlueprintType)
 class ALSCAMERA_API UAlsCameraSettings : public UDataAsset
 {
@@ -88,8 +102,25 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FPostProcessSettings PostProcess;
 
+	// Post process settings that are blended on top of the main ones, each with its own weight driven by an
+	// animation curve. Requires UAlsCameraPostProcessModifier to be added to the player camera manager.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TArray<FAlsCameraPostProcessLayerSettings> PostProcessLayers;
+
+	FAlsPostProcessOverrides PostProcessOverrides;
+
 public:
 #if WITH_EDITORONLY_DATA
 	virtual void Serialize(FArchive& Archive) override;
 #endif
+
+	virtual void PostInitProperties() override;
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent) override;
+
+	virtual void PostEditUndo() override;
+#endif
 };
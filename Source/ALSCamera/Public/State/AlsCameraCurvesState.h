@@ -0,0 +1,35 @@
+#pragma once
+
+#include "AlsCameraCurvesState.generated.h"
+
+// Values of all camera animation curves, captured once after the camera animation instance has been
+// evaluated, so that the camera calculations don't have to look up each curve separately.
+USTRUCT(BlueprintType)
+struct ALSCAMERA_API FAlsCameraCurvesState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector3f PivotOffset{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector3f CameraOffset{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector3f LocationLag{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	float RotationLag{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "deg"))
+	float FovOffset{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
+	float FirstPersonOverride{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
+	float TraceOverride{0.0f};
+
+public:
+	void Refresh(const TMap<FName, float>& Curves);
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Engine/Scene.h"
+
+class FBoolProperty;
+class FProperty;
+
+// Only post process properties enabled by their override flags affect the final post process, so copying only them
+// instead of the whole post process settings structure, which is several kilobytes in size, is much cheaper. The list
+// of these properties is built once for specific post process settings and must be refreshed when they change.
+struct ALSCAMERA_API FAlsPostProcessOverrides
+{
+private:
+	TArray<TPair<const FBoolProperty*, const FProperty*>> Properties;
+
+	uint8 bCopyWeightedBlendables : 1 {false};
+
+	// Set if some override flag could not be matched with its property, in which case the whole structure is copied.
+	uint8 bCopyAllProperties : 1 {false};
+
+public:
+	void Refresh(const FPostProcessSettings& Settings);
+
+	void Apply(const FPostProcessSettings& Source, FPostProcessSettings& Target) const;
+};
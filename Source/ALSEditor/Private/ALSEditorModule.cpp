@@ -1,5 +1,22 @@
 #include "ALSEditorModule.h"
 
+#include "Features/IModularFeatures.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_MODULE(FDefaultModuleImpl, ALSEditor)
+IMPLEMENT_MODULE(FAlsEditorModule, ALSEditor)
+
+void FAlsEditorModule::StartupModule()
+{
+	auto& ModularFeatures{IModularFeatures::Get()};
+
+	ModularFeatures.RegisterModularFeature(TraceServices::ModuleFeatureName, &TraceModule);
+	ModularFeatures.RegisterModularFeature(RewindDebugger::IRewindDebuggerTrackCreator::ModularFeatureName, &RewindDebuggerTrackCreator);
+}
+
+void FAlsEditorModule::ShutdownModule()
+{
+	auto& ModularFeatures{IModularFeatures::Get()};
+
+	ModularFeatures.UnregisterModularFeature(RewindDebugger::IRewindDebuggerTrackCreator::ModularFeatureName, &RewindDebuggerTrackCreator);
+	ModularFeatures.UnregisterModularFeature(TraceServices::ModuleFeatureName, &TraceModule);
+}
@@ -1 +1,18 @@
 #pragma once
+
+#include "Modules/ModuleInterface.h"
+#include "Trace/AlsRewindDebuggerTrack.h"
+#include "Trace/AlsTraceModule.h"
+
+class FAlsEditorModule : public IModuleInterface
+{
+private:
+	FAlsTraceModule TraceModule;
+
+	FAlsRewindDebuggerTrackCreator RewindDebuggerTrackCreator;
+
+public:
+	virtual void StartupModule() override;
+
+	virtual void ShutdownModule() override;
+};
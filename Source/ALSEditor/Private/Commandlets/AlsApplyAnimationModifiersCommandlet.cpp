@@ -0,0 +1,207 @@
+#include "Commandlets/AlsApplyAnimationModifiersCommandlet.h"
+
+#include "AnimationModifier.h"
+#include "AnimationModifiersAssetUserData.h"
+#include "FileHelpers.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/AnimData/IAnimationDataModel.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+#include "Utility/AlsLog.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsApplyAnimationModifiersCommandlet)
+
+namespace AlsApplyAnimationModifiersCommandlet
+{
+	static FString GetHashesFilePath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("Als") / TEXT("AnimationModifiersHashes.txt");
+	}
+
+	static void LoadHashes(TMap<FName, FGuid>& Hashes)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *GetHashesFilePath()))
+		{
+			return;
+		}
+
+		for (const auto& Line : Lines)
+		{
+			FString PackageName;
+			FString HashString;
+			FGuid Hash;
+
+			if (Line.Split(TEXT("="), &PackageName, &HashString) && FGuid::Parse(HashString, Hash))
+			{
+				Hashes.Add(FName{PackageName}, Hash);
+			}
+		}
+	}
+
+	static void SaveHashes(const TMap<FName, FGuid>& Hashes)
+	{
+		TArray<FString> Lines;
+		Lines.Reserve(Hashes.Num());
+
+		for (const auto& [PackageName, Hash] : Hashes)
+		{
+			Lines.Add(PackageName.ToString() + TEXT("=") + Hash.ToString());
+		}
+
+		FFileHelper::SaveStringArrayToFile(Lines, *GetHashesFilePath());
+	}
+
+	// The hash covers the animation data and the modifiers applied to it, including the revisions of their classes, so that
+	// sequences are processed again when a modifier blueprint is recompiled, even if their animation data hasn't changed.
+
+	static FGuid GenerateHash(const UAnimSequence& Sequence, const UAnimationModifiersAssetUserData& UserData)
+	{
+		// The revision is a private property of the modifier, which is updated on the class default object every
+		// time the modifier blueprint is compiled, so it is accessed through reflection to not depend on its layout.
+
+		static const auto* RevisionGuidProperty{FindFProperty<FStructProperty>(UAnimationModifier::StaticClass(), TEXT("RevisionGuid"))};
+
+		auto Hash{Sequence.GetDataModel()->GenerateGuid()};
+
+		for (const auto* Modifier : UserData.GetAnimationModifierInstances())
+		{
+			if (!IsValid(Modifier))
+			{
+				continue;
+			}
+
+			const auto* ModifierClass{Modifier->GetClass()};
+
+			Hash = FGuid::Combine(Hash, FGuid::NewDeterministicGuid(ModifierClass->GetPathName()));
+
+			if (RevisionGuidProperty != nullptr && RevisionGuidProperty->Struct == TBaseStructure<FGuid>::Get())
+			{
+				Hash = FGuid::Combine(Hash, *RevisionGuidProperty->ContainerPtrToValuePtr<FGuid>(ModifierClass->GetDefaultObject()));
+			}
+		}
+
+		return Hash;
+	}
+}
+
+UAlsApplyAnimationModifiersCommandlet::UAlsApplyAnimationModifiersCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAlsApplyAnimationModifiersCommandlet::Main(const FString& Params)
+{
+	FString PathsString{TEXT("/Game")};
+	FParse::Value(*Params, TEXT("Paths="), PathsString);
+
+	auto BatchSize{64};
+	FParse::Value(*Params, TEXT("BatchSize="), BatchSize);
+	BatchSize = FMath::Max(1, BatchSize);
+
+	const auto bForce{FParse::Param(*Params, TEXT("Force"))};
+
+	TArray<FString> Paths;
+	PathsString.ParseIntoArray(Paths, TEXT("+"));
+
+	auto& AssetRegistry{FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get()};
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UAnimSequence::StaticClass()->GetClassPathName());
+	Filter.bRecursivePaths = true;
+
+	for (const auto& Path : Paths)
+	{
+		Filter.PackagePaths.Add(FName{Path});
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	UE_LOG(LogAls, Display, TEXT("Found %d animation sequences in %s."), Assets.Num(), *PathsString);
+
+	TMap<FName, FGuid> Hashes;
+	AlsApplyAnimationModifiersCommandlet::LoadHashes(Hashes);
+
+	auto AppliedCount{0};
+	auto SkippedCount{0};
+
+	for (auto BatchIndex{0}; BatchIndex < Assets.Num(); BatchIndex += BatchSize)
+	{
+		const auto BatchEnd{FMath::Min(BatchIndex + BatchSize, Assets.Num())};
+
+		// Modifiers can only change the animation data on the game thread, so only
+		// the package loading of the whole batch is done in parallel beforehand.
+
+		for (auto i{BatchIndex}; i < BatchEnd; i++)
+		{
+			LoadPackageAsync(Assets[i].PackageName.ToString());
+		}
+
+		FlushAsyncLoading();
+
+		TArray<UPackage*> DirtyPackages;
+
+		for (auto i{BatchIndex}; i < BatchEnd; i++)
+		{
+			auto* Sequence{Cast<UAnimSequence>(Assets[i].GetAsset())};
+			if (!IsValid(Sequence))
+			{
+				continue;
+			}
+
+			const auto* UserData{Sequence->GetAssetUserData<UAnimationModifiersAssetUserData>()};
+			if (UserData == nullptr || UserData->GetAnimationModifierInstances().IsEmpty())
+			{
+				continue;
+			}
+
+			const auto* ExistingHash{Hashes.Find(Assets[i].PackageName)};
+			if (!bForce && ExistingHash != nullptr &&
+			    *ExistingHash == AlsApplyAnimationModifiersCommandlet::GenerateHash(*Sequence, *UserData))
+			{
+				SkippedCount += 1;
+				continue;
+			}
+
+			for (auto* Modifier : UserData->GetAnimationModifierInstances())
+			{
+				if (IsValid(Modifier))
+				{
+					Modifier->ApplyToAnimationSequence(Sequence);
+				}
+			}
+
+			Hashes.Add(Assets[i].PackageName, AlsApplyAnimationModifiersCommandlet::GenerateHash(*Sequence, *UserData));
+
+			Sequence->MarkPackageDirty();
+			DirtyPackages.Add(Sequence->GetPackage());
+
+			AppliedCount += 1;
+		}
+
+		if (!DirtyPackages.IsEmpty())
+		{
+			UEditorLoadingAndSavingUtils::SavePackages(DirtyPackages, true);
+		}
+
+		// Save the hashes after each batch, so that an interrupted run can be continued.
+
+		AlsApplyAnimationModifiersCommandlet::SaveHashes(Hashes);
+
+		CollectGarbage(RF_NoFlags);
+
+		UE_LOG(LogAls, Display, TEXT("Processed %d of %d animation sequences."), BatchEnd, Assets.Num());
+	}
+
+	UE_LOG(LogAls, Display, TEXT("Applied animation modifiers to %d animation sequences, skipped %d unchanged."),
+	       AppliedCount, SkippedCount);
+
+	return 0;
+}
@@ -0,0 +1,124 @@
+#include "Modifiers/AlsAnimationModifierUtility.h"
+
+#include "Animation/AnimData/IAnimationDataController.h"
+#include "Animation/AnimData/IAnimationDataModel.h"
+#include "Animation/AnimSequence.h"
+#include "Utility/AlsLog.h"
+
+#define LOCTEXT_NAMESPACE "AlsAnimationModifierUtility"
+
+bool FAlsAnimationModifierUtility::DoesFloatCurveExist(const UAnimSequence* Sequence, const FName& CurveName)
+{
+	return Sequence->GetDataModel()->FindFloatCurve({CurveName, ERawCurveTrackTypes::RCT_Float}) != nullptr;
+}
+
+void FAlsAnimationModifierUtility::SetFloatCurve(UAnimSequence* Sequence, const FName& CurveName, TArray<FRichCurveKey> Keys)
+{
+	// Keys added one by one were sorted by time and replaced existing keys with the same time, so do the same here.
+
+	Keys.StableSort([](const FRichCurveKey& A, const FRichCurveKey& B)
+	{
+		return A.Time < B.Time;
+	});
+
+	for (auto i{Keys.Num() - 1}; i > 0; i--)
+	{
+		if (FMath::IsNearlyEqual(Keys[i - 1].Time, Keys[i].Time))
+		{
+			Keys.RemoveAt(i - 1, EAllowShrinking::No);
+		}
+	}
+
+	auto& Controller{Sequence->GetController()};
+	const FAnimationCurveIdentifier CurveId{CurveName, ERawCurveTrackTypes::RCT_Float};
+
+	IAnimationDataController::FScopedBracket ScopedBracket{Controller, LOCTEXT("SetFloatCurve", "Set Float Curve")};
+
+	if (Sequence->GetDataModel()->FindFloatCurve(CurveId) != nullptr)
+	{
+		Controller.RemoveCurve(CurveId);
+	}
+
+	Controller.AddCurve(CurveId);
+	Controller.SetCurveKeys(CurveId, Keys);
+}
+
+int32 FAlsAnimationModifierUtility::ReduceKeys(TArray<FRichCurveKey>& Keys, const float Tolerance)
+{
+	const auto PreviousKeysCount{Keys.Num()};
+	if (PreviousKeysCount <= 1)
+	{
+		return 0;
+	}
+
+	TArray<FRichCurveKey> NewKeys;
+	NewKeys.Reserve(PreviousKeysCount);
+	NewKeys.Add(Keys[0]);
+
+	// A key is removed if all keys between the last kept key and the next key
+	// lie on the line between them, so the error doesn't accumulate over a segment.
+
+	auto SegmentStartIndex{0};
+
+	for (auto i{1}; i < PreviousKeysCount - 1; i++)
+	{
+		const auto& StartKey{Keys[SegmentStartIndex]};
+		const auto& EndKey{Keys[i + 1]};
+
+		auto bKeysOnLine{true};
+
+		for (auto j{SegmentStartIndex + 1}; j <= i; j++)
+		{
+			const auto Alpha{(Keys[j].Time - StartKey.Time) / FMath::Max(EndKey.Time - StartKey.Time, UE_SMALL_NUMBER)};
+
+			if (!FMath::IsNearlyEqual(FMath::Lerp(StartKey.Value, EndKey.Value, Alpha), Keys[j].Value, Tolerance))
+			{
+				bKeysOnLine = false;
+				break;
+			}
+		}
+
+		if (!bKeysOnLine)
+		{
+			NewKeys.Add(Keys[i]);
+			SegmentStartIndex = i;
+		}
+	}
+
+	NewKeys.Add(Keys.Last());
+
+	// Curves are extrapolated with a constant value, so the first and last keys are
+	// not needed if they have the same value as their neighbors. This also reduces
+	// constant curves to a single key.
+
+	if (NewKeys.Num() > 1 && FMath::IsNearlyEqual(NewKeys.Last().Value, NewKeys.Last(1).Value, Tolerance))
+	{
+		NewKeys.Pop(EAllowShrinking::No);
+	}
+
+	if (NewKeys.Num() > 1 && FMath::IsNearlyEqual(NewKeys[0].Value, NewKeys[1].Value, Tolerance))
+	{
+		NewKeys.RemoveAt(0, EAllowShrinking::No);
+	}
+
+	Keys = MoveTemp(NewKeys);
+
+	return PreviousKeysCount - Keys.Num();
+}
+
+void FAlsAnimationModifierUtility::LogKeysReduction(const UAnimSequence* Sequence, const int32 PreviousKeysCount,
+                                                    const int32 NewKeysCount)
+{
+	if (PreviousKeysCount <= NewKeysCount)
+	{
+		return;
+	}
+
+	// The saved memory is estimated from the size of the raw keys, the actual size of the compressed curves depends on the codec.
+
+	UE_LOG(LogAls, Log, TEXT("%s: curve keys reduced from %d to %d, %d bytes of curve memory saved."),
+	       *Sequence->GetPathName(), PreviousKeysCount, NewKeysCount,
+	       (PreviousKeysCount - NewKeysCount) * static_cast<int32>(sizeof(FRichCurveKey)));
+}
+
+#undef LOCTEXT_NAMESPACE
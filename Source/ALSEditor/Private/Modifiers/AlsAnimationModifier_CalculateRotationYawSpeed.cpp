@@ -1,6 +1,7 @@
 ﻿#include "Modifiers/AlsAnimationModifier_CalculateRotationYawSpeed.h"
 
 #include "Animation/AnimSequence.h"
+#include "Modifiers/AlsAnimationModifierUtility.h"
 #include "Utility/AlsConstants.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationModifier_CalculateRotationYawSpeed)
@@ -9,17 +10,13 @@ void UAlsAnimationModifier_CalculateRotationYawSpeed::OnApply_Implementation(UAn
 {
 	Super::OnApply_Implementation(Sequence);
 
-	if (UAnimationBlueprintLibrary::DoesCurveExist(Sequence, UAlsConstants::RotationYawSpeedCurveName(), ERawCurveTrackTypes::RCT_Float))
-	{
-		UAnimationBlueprintLibrary::RemoveCurve(Sequence, UAlsConstants::RotationYawSpeedCurveName());
-	}
-
-	UAnimationBlueprintLibrary::AddCurve(Sequence, UAlsConstants::RotationYawSpeedCurveName());
-
 	const auto* DataModel{Sequence->GetDataModel()};
 	const auto FrameRate{Sequence->GetSamplingFrameRate().AsDecimal()};
 
-	UAnimationBlueprintLibrary::AddFloatCurveKey(Sequence, UAlsConstants::RotationYawSpeedCurveName(), 0.0f, 0.0f);
+	TArray<FRichCurveKey> CurveKeys;
+	CurveKeys.Reserve(Sequence->GetNumberOfSampledKeys());
+
+	CurveKeys.Emplace(0.0f, 0.0f);
 
 	for (auto i{1}; i < Sequence->GetNumberOfSampledKeys(); i++)
 	{
@@ -31,9 +28,18 @@ void UAlsAnimationModifier_CalculateRotationYawSpeed::OnApply_Implementation(UAn
 			DataModel->GetBoneTrackTransform(UAlsConstants::RootBoneName(), i + (Sequence->RateScale >= 0.0f ? 0 : -1))
 		};
 
-		UAnimationBlueprintLibrary::AddFloatCurveKey(Sequence, UAlsConstants::RotationYawSpeedCurveName(), Sequence->GetTimeAtFrame(i),
-		                                             UE_REAL_TO_FLOAT(
-			                                             (NextPoseTransform.Rotator().Yaw - CurrentPoseTransform.Rotator().Yaw) *
-			                                             FMath::Abs(Sequence->RateScale) * FrameRate));
+		CurveKeys.Emplace(Sequence->GetTimeAtFrame(i),
+		                  UE_REAL_TO_FLOAT((NextPoseTransform.Rotator().Yaw - CurrentPoseTransform.Rotator().Yaw) *
+		                                   FMath::Abs(Sequence->RateScale) * FrameRate));
 	}
+
+	if (bReduceKeys)
+	{
+		const auto PreviousKeysCount{CurveKeys.Num()};
+
+		FAlsAnimationModifierUtility::ReduceKeys(CurveKeys, KeysReductionTolerance);
+		FAlsAnimationModifierUtility::LogKeysReduction(Sequence, PreviousKeysCount, CurveKeys.Num());
+	}
+
+	FAlsAnimationModifierUtility::SetFloatCurve(Sequence, UAlsConstants::RotationYawSpeedCurveName(), MoveTemp(CurveKeys));
 }
@@ -1,10 +1,14 @@
 ﻿#include "Modifiers/AlsAnimationModifier_CopyCurves.h"
 
 #include "Animation/AnimSequence.h"
+#include "Animation/AnimData/IAnimationDataController.h"
+#include "Modifiers/AlsAnimationModifierUtility.h"
 #include "Utility/AlsMacros.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationModifier_CopyCurves)
 
+#define LOCTEXT_NAMESPACE "AlsAnimationModifier_CopyCurves"
+
 void UAlsAnimationModifier_CopyCurves::OnApply_Implementation(UAnimSequence* Sequence)
 {
 	Super::OnApply_Implementation(Sequence);
@@ -15,9 +19,13 @@ void UAlsAnimationModifier_CopyCurves::OnApply_Implementation(UAnimSequence* Seq
 		return;
 	}
 
+	// Group all curve changes into a single data model change.
+
+	IAnimationDataController::FScopedBracket ScopedBracket{Sequence->GetController(), LOCTEXT("CopyCurves", "Copy Curves")};
+
 	if (bCopyAllCurves)
 	{
-		for (const auto& Curve : SourceSequenceObject->GetCurveData().FloatCurves)
+		for (const auto& Curve : SourceSequenceObject->GetDataModel()->GetFloatCurves())
 		{
 			CopyCurve(SourceSequenceObject, Sequence, Curve.GetName());
 		}
@@ -26,7 +34,7 @@ void UAlsAnimationModifier_CopyCurves::OnApply_Implementation(UAnimSequence* Seq
 	{
 		for (const auto& CurveName : CurveNames)
 		{
-			if (UAnimationBlueprintLibrary::DoesCurveExist(SourceSequenceObject, CurveName, ERawCurveTrackTypes::RCT_Float))
+			if (FAlsAnimationModifierUtility::DoesFloatCurveExist(SourceSequenceObject, CurveName))
 			{
 				CopyCurve(SourceSequenceObject, Sequence, CurveName);
 			}
@@ -36,16 +44,11 @@ void UAlsAnimationModifier_CopyCurves::OnApply_Implementation(UAnimSequence* Seq
 
 void UAlsAnimationModifier_CopyCurves::CopyCurve(UAnimSequence* SourceSequence, UAnimSequence* TargetSequence, const FName& CurveName)
 {
-	if (UAnimationBlueprintLibrary::DoesCurveExist(TargetSequence, CurveName, ERawCurveTrackTypes::RCT_Float))
+	const auto* SourceCurve{SourceSequence->GetDataModel()->FindFloatCurve({CurveName, ERawCurveTrackTypes::RCT_Float})};
+	if (SourceCurve != nullptr)
 	{
-		UAnimationBlueprintLibrary::RemoveCurve(TargetSequence, CurveName);
+		FAlsAnimationModifierUtility::SetFloatCurve(TargetSequence, CurveName, SourceCurve->FloatCurve.GetConstRefOfKeys());
 	}
-
-	UAnimationBlueprintLibrary::AddCurve(TargetSequence, CurveName);
-
-	TArray<float> CurveTimes;
-	TArray<float> CurveValues;
-
-	UAnimationBlueprintLibrary::GetFloatKeys(SourceSequence, CurveName, CurveTimes, CurveValues);
-	UAnimationBlueprintLibrary::AddFloatCurveKeys(TargetSequence, CurveName, CurveTimes, CurveValues);
 }
+
+#undef LOCTEXT_NAMESPACE
@@ -1,41 +1,49 @@
 ﻿#include "Modifiers/AlsAnimationModifier_CreateCurves.h"
 
 #include "Animation/AnimSequence.h"
+#include "Animation/AnimData/IAnimationDataController.h"
+#include "Modifiers/AlsAnimationModifierUtility.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationModifier_CreateCurves)
 
+#define LOCTEXT_NAMESPACE "AlsAnimationModifier_CreateCurves"
+
 void UAlsAnimationModifier_CreateCurves::OnApply_Implementation(UAnimSequence* Sequence)
 {
 	Super::OnApply_Implementation(Sequence);
 
+	// Group all curve changes into a single data model change.
+
+	IAnimationDataController::FScopedBracket ScopedBracket{Sequence->GetController(), LOCTEXT("CreateCurves", "Create Curves")};
+
+	TArray<FRichCurveKey> CurveKeys;
+
 	for (const auto& Curve : Curves)
 	{
-		if (UAnimationBlueprintLibrary::DoesCurveExist(Sequence, Curve.Name, ERawCurveTrackTypes::RCT_Float))
+		if (!bOverrideExistingCurves && FAlsAnimationModifierUtility::DoesFloatCurveExist(Sequence, Curve.Name))
 		{
-			if (!bOverrideExistingCurves)
-			{
-				continue;
-			}
-
-			UAnimationBlueprintLibrary::RemoveCurve(Sequence, Curve.Name);
+			continue;
 		}
 
-		UAnimationBlueprintLibrary::AddCurve(Sequence, Curve.Name);
+		CurveKeys.Reset();
 
 		if (Curve.bAddKeyOnEachFrame)
 		{
 			for (auto i{0}; i < Sequence->GetNumberOfSampledKeys(); i++)
 			{
-				UAnimationBlueprintLibrary::AddFloatCurveKey(Sequence, Curve.Name, Sequence->GetTimeAtFrame(i), 0);
+				CurveKeys.Emplace(Sequence->GetTimeAtFrame(i), 0.0f);
 			}
 		}
 		else
 		{
 			for (const auto& CurveKey : Curve.Keys)
 			{
-				UAnimationBlueprintLibrary::AddFloatCurveKey(Sequence, Curve.Name, Sequence->GetTimeAtFrame(CurveKey.Frame),
-				                                             CurveKey.Value);
+				CurveKeys.Emplace(Sequence->GetTimeAtFrame(CurveKey.Frame), CurveKey.Value);
 			}
 		}
+
+		FAlsAnimationModifierUtility::SetFloatCurve(Sequence, Curve.Name, CurveKeys);
 	}
 }
+
+#undef LOCTEXT_NAMESPACE
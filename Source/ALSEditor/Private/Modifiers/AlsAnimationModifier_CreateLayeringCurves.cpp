@@ -1,48 +1,74 @@
 ﻿#include "Modifiers/AlsAnimationModifier_CreateLayeringCurves.h"
 
 #include "Animation/AnimSequence.h"
+#include "Animation/AnimData/IAnimationDataController.h"
+#include "Modifiers/AlsAnimationModifierUtility.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationModifier_CreateLayeringCurves)
 
+#define LOCTEXT_NAMESPACE "AlsAnimationModifier_CreateLayeringCurves"
+
 void UAlsAnimationModifier_CreateLayeringCurves::OnApply_Implementation(UAnimSequence* Sequence)
 {
 	Super::OnApply_Implementation(Sequence);
 
-	CreateCurves(Sequence, CurveNames, CurveValue);
+	// Group all curve changes into a single data model change.
+
+	IAnimationDataController::FScopedBracket ScopedBracket{Sequence->GetController(), LOCTEXT("CreateLayeringCurves", "Create Layering Curves")};
+
+	auto PreviousKeysCount{0};
+	auto NewKeysCount{0};
+
+	CreateCurves(Sequence, CurveNames, CurveValue, PreviousKeysCount, NewKeysCount);
 
 	if (bAddSlotCurves)
 	{
-		CreateCurves(Sequence, SlotCurveNames, SlotCurveValue);
+		CreateCurves(Sequence, SlotCurveNames, SlotCurveValue, PreviousKeysCount, NewKeysCount);
 	}
+
+	FAlsAnimationModifierUtility::LogKeysReduction(Sequence, PreviousKeysCount, NewKeysCount);
 }
 
-void UAlsAnimationModifier_CreateLayeringCurves::CreateCurves(UAnimSequence* Sequence, const TArray<FName>& Names,
-                                                              const float Value) const
+void UAlsAnimationModifier_CreateLayeringCurves::CreateCurves(UAnimSequence* Sequence, const TArray<FName>& Names, const float Value,
+                                                              int32& PreviousKeysCount, int32& NewKeysCount) const
 {
-	for (const auto& CurveName : Names)
+	TArray<FRichCurveKey> CurveKeys;
+
+	if (bAddKeyOnEachFrame)
 	{
-		if (UAnimationBlueprintLibrary::DoesCurveExist(Sequence, CurveName, ERawCurveTrackTypes::RCT_Float))
-		{
-			if (!bOverrideExistingCurves)
-			{
-				continue;
-			}
+		CurveKeys.Reserve(Sequence->GetNumberOfSampledKeys());
 
-			UAnimationBlueprintLibrary::RemoveCurve(Sequence, CurveName);
+		for (auto i{0}; i < Sequence->GetNumberOfSampledKeys(); i++)
+		{
+			CurveKeys.Emplace(Sequence->GetTimeAtFrame(i), Value);
 		}
+	}
+	else
+	{
+		CurveKeys.Emplace(Sequence->GetTimeAtFrame(0), Value);
+	}
 
-		UAnimationBlueprintLibrary::AddCurve(Sequence, CurveName);
+	const auto CurveKeysCount{CurveKeys.Num()};
 
-		if (bAddKeyOnEachFrame)
-		{
-			for (auto i{0}; i < Sequence->GetNumberOfSampledKeys(); i++)
-			{
-				UAnimationBlueprintLibrary::AddFloatCurveKey(Sequence, CurveName, Sequence->GetTimeAtFrame(i), Value);
-			}
-		}
-		else
+	if (bReduceKeys && !bAddKeyOnEachFrame)
+	{
+		FAlsAnimationModifierUtility::ReduceKeys(CurveKeys, KeysReductionTolerance);
+	}
+
+	// The keys are the same for all curves, so they are built only once.
+
+	for (const auto& CurveName : Names)
+	{
+		if (!bOverrideExistingCurves && FAlsAnimationModifierUtility::DoesFloatCurveExist(Sequence, CurveName))
 		{
-			UAnimationBlueprintLibrary::AddFloatCurveKey(Sequence, CurveName, Sequence->GetTimeAtFrame(0), Value);
+			continue;
 		}
+
+		FAlsAnimationModifierUtility::SetFloatCurve(Sequence, CurveName, CurveKeys);
+
+		PreviousKeysCount += CurveKeysCount;
+		NewKeysCount += CurveKeys.Num();
 	}
 }
+
+#undef LOCTEXT_NAMESPACE
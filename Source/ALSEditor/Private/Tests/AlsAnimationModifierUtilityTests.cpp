@@ -0,0 +1,113 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Modifiers/AlsAnimationModifierUtility.h"
+
+namespace AlsAnimationModifierUtilityTests
+{
+	struct FExpectedKey
+	{
+		float Time{0.0f};
+
+		float Value{0.0f};
+	};
+
+	static TArray<FRichCurveKey> MakeKeys(const TArray<float>& Values)
+	{
+		TArray<FRichCurveKey> Keys;
+		Keys.Reserve(Values.Num());
+
+		for (auto i{0}; i < Values.Num(); i++)
+		{
+			Keys.Emplace(static_cast<float>(i), Values[i]);
+		}
+
+		return Keys;
+	}
+
+	static bool AreKeysEqual(const TArray<FRichCurveKey>& Keys, const TArray<FExpectedKey>& ExpectedKeys)
+	{
+		if (Keys.Num() != ExpectedKeys.Num())
+		{
+			return false;
+		}
+
+		for (auto i{0}; i < Keys.Num(); i++)
+		{
+			if (!FMath::IsNearlyEqual(Keys[i].Time, ExpectedKeys[i].Time) || !FMath::IsNearlyEqual(Keys[i].Value, ExpectedKeys[i].Value))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsAnimationModifierUtilityReduceKeysTest, "Als.Editor.AnimationModifierUtility.ReduceKeys",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsAnimationModifierUtilityReduceKeysTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsAnimationModifierUtilityTests;
+
+	static constexpr auto Tolerance{0.0001f};
+
+	{
+		TArray<FRichCurveKey> Keys;
+
+		TestEqual(TEXT("Empty curve: no keys removed"), FAlsAnimationModifierUtility::ReduceKeys(Keys, Tolerance), 0);
+
+		Keys = MakeKeys({1.0f});
+
+		TestEqual(TEXT("Single key curve: no keys removed"), FAlsAnimationModifierUtility::ReduceKeys(Keys, Tolerance), 0);
+		TestTrue(TEXT("Single key curve: key is kept"), AreKeysEqual(Keys, {{0.0f, 1.0f}}));
+	}
+
+	// Curves are extrapolated with a constant value, so a flat curve is reduced to a single key.
+
+	{
+		auto Keys{MakeKeys({1.0f, 1.0f, 1.0f, 1.0f, 1.0f})};
+
+		TestEqual(TEXT("Flat curve: removed keys"), FAlsAnimationModifierUtility::ReduceKeys(Keys, Tolerance), 4);
+		TestTrue(TEXT("Flat curve: first key is kept"), AreKeysEqual(Keys, {{0.0f, 1.0f}}));
+	}
+
+	// Keys on a line are removed, while both endpoint keys are kept, since they differ from their neighbors.
+
+	{
+		auto Keys{MakeKeys({0.0f, 1.0f, 2.0f, 3.0f, 4.0f})};
+
+		TestEqual(TEXT("Linear curve: removed keys"), FAlsAnimationModifierUtility::ReduceKeys(Keys, Tolerance), 3);
+		TestTrue(TEXT("Linear curve: endpoint keys are kept"), AreKeysEqual(Keys, {{0.0f, 0.0f}, {4.0f, 4.0f}}));
+	}
+
+	// Endpoint keys with the same value as their neighbors are removed, but the keys where the curve changes are kept.
+
+	{
+		auto Keys{MakeKeys({0.0f, 0.0f, 1.0f, 1.0f})};
+
+		TestEqual(TEXT("Step curve: removed keys"), FAlsAnimationModifierUtility::ReduceKeys(Keys, Tolerance), 2);
+		TestTrue(TEXT("Step curve: inner keys are kept"), AreKeysEqual(Keys, {{1.0f, 0.0f}, {2.0f, 1.0f}}));
+	}
+
+	// Deviations within the tolerance are removed, deviations outside of it are kept.
+
+	{
+		auto Keys{MakeKeys({0.0f, Tolerance * 0.5f, 0.0f})};
+
+		TestEqual(TEXT("Deviation within tolerance: removed keys"), FAlsAnimationModifierUtility::ReduceKeys(Keys, Tolerance), 2);
+		TestEqual(TEXT("Deviation within tolerance: keys count"), Keys.Num(), 1);
+
+		Keys = MakeKeys({0.0f, Tolerance * 2.0f, 0.0f});
+
+		TestEqual(TEXT("Deviation outside tolerance: removed keys"), FAlsAnimationModifierUtility::ReduceKeys(Keys, Tolerance), 0);
+		TestTrue(TEXT("Deviation outside tolerance: all keys are kept"),
+		         AreKeysEqual(Keys, {{0.0f, 0.0f}, {1.0f, Tolerance * 2.0f}, {2.0f, 0.0f}}));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,507 @@
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && !UE_BUILD_SHIPPING
+
+#include "AlsCharacter.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Settings/LevelEditorPlaySettings.h"
+#include "Tests/AutomationCommon.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsLog.h"
+#include "Utility/AlsStats.h"
+
+// Measures the network cost of ALS characters. Runs a listen or dedicated server and simulated clients in one process
+// using play in editor, drives every player character with a scripted locomotion and action sequence, and reports
+// bandwidth, RPCs, replicated property updates and movement corrections per character. Can be run headless, for example:
+// UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests Als.Net.Benchmark; Quit"
+
+namespace AlsNetworkBenchmark
+{
+	static FString MapName{TEXT("/ALS/ALSExtras/Levels/L_Als_Playground")};
+	static FAutoConsoleVariableRef ConsoleVariableMapName{
+		TEXT("als.NetworkBenchmark.MapName"), MapName,
+		TEXT("Map used by the ALS network benchmark. Its game mode must spawn ALS characters for players."),
+		ECVF_Default
+	};
+
+	static auto ClientsCount{4};
+	static FAutoConsoleVariableRef ConsoleVariableClientsCount{
+		TEXT("als.NetworkBenchmark.ClientsCount"), ClientsCount,
+		TEXT("Number of simulated clients used by the ALS network benchmark."),
+		ECVF_Default
+	};
+
+	static auto bDedicatedServer{false};
+	static FAutoConsoleVariableRef ConsoleVariableDedicatedServer{
+		TEXT("als.NetworkBenchmark.DedicatedServer"), bDedicatedServer,
+		TEXT("If enabled, the ALS network benchmark uses a dedicated server instead of a listen server."),
+		ECVF_Default
+	};
+
+	static auto Duration{20.0f};
+	static FAutoConsoleVariableRef ConsoleVariableDuration{
+		TEXT("als.NetworkBenchmark.Duration"), Duration,
+		TEXT("Duration of the ALS network benchmark measurement in seconds."),
+		ECVF_Default
+	};
+
+	static auto Latency{50};
+	static FAutoConsoleVariableRef ConsoleVariableLatency{
+		TEXT("als.NetworkBenchmark.Latency"), Latency,
+		TEXT("Simulated one way latency of the ALS network benchmark in milliseconds."),
+		ECVF_Default
+	};
+
+	static auto PacketLoss{1};
+	static FAutoConsoleVariableRef ConsoleVariablePacketLoss{
+		TEXT("als.NetworkBenchmark.PacketLoss"), PacketLoss,
+		TEXT("Simulated packet loss of the ALS network benchmark in percent."),
+		ECVF_Default
+	};
+
+	// Time allowed for the play session to start and for all clients to get their characters.
+	static constexpr auto StartTimeout{60.0};
+
+	// The scripted sequence is repeated with this period.
+	static constexpr auto SequenceDuration{20.0f};
+
+	struct FSimulatedProxyState
+	{
+		TArray<FString> PropertyValues;
+	};
+
+	struct FBenchmarkState
+	{
+		double StartTime{0.0};
+
+		float ElapsedTime{0.0f};
+
+		int32 CharactersCount{0};
+
+		double ServerOutBytes{0.0};
+
+		double ServerInBytes{0.0};
+
+		TArray<const FProperty*> ReplicatedProperties;
+
+		TMap<TWeakObjectPtr<AAlsCharacter>, FSimulatedProxyState> SimulatedProxies;
+
+		TMap<FName, int64> ReplicatedPropertyUpdates;
+	};
+
+	static UWorld* FindServerWorld()
+	{
+		for (const auto& WorldContext : GEngine->GetWorldContexts())
+		{
+			auto* World{WorldContext.World()};
+
+			if (WorldContext.WorldType == EWorldType::PIE && IsValid(World) &&
+			    (World->GetNetMode() == NM_ListenServer || World->GetNetMode() == NM_DedicatedServer))
+			{
+				return World;
+			}
+		}
+
+		return nullptr;
+	}
+
+	template <typename FunctionType>
+	static void ForEachClientWorld(FunctionType&& Function)
+	{
+		for (const auto& WorldContext : GEngine->GetWorldContexts())
+		{
+			auto* World{WorldContext.World()};
+
+			if (WorldContext.WorldType == EWorldType::PIE && IsValid(World) && World->GetNetMode() == NM_Client)
+			{
+				Function(*World);
+			}
+		}
+	}
+
+	static AAlsCharacter* GetLocalCharacter(const UWorld& World)
+	{
+		const auto* Player{World.GetFirstPlayerController()};
+		return IsValid(Player) ? Cast<AAlsCharacter>(Player->GetPawn()) : nullptr;
+	}
+
+	static void StartPlaySession()
+	{
+		auto* PlaySettings{NewObject<ULevelEditorPlaySettings>()};
+		PlaySettings->SetPlayNetMode(bDedicatedServer ? PIE_Client : PIE_ListenServer);
+		PlaySettings->SetPlayNumberOfClients(bDedicatedServer ? ClientsCount : ClientsCount + 1);
+		PlaySettings->SetRunUnderOneProcess(true);
+
+		auto& NetworkEmulation{PlaySettings->NetworkEmulationSettings};
+		NetworkEmulation.bIsNetworkEmulationEnabled = Latency > 0 || PacketLoss > 0;
+		NetworkEmulation.EmulationTarget = NetworkEmulationTarget::Any;
+
+		for (auto* PacketSettings : {&NetworkEmulation.OutPackets, &NetworkEmulation.InPackets})
+		{
+			PacketSettings->MinLatency = Latency;
+			PacketSettings->MaxLatency = Latency;
+			PacketSettings->PacketLossPercentage = PacketLoss;
+		}
+
+		FRequestPlaySessionParams Parameters;
+		Parameters.WorldType = EPlaySessionWorldType::PlayInEditor;
+		Parameters.EditorPlaySettings = PlaySettings;
+
+		GEditor->RequestPlaySession(Parameters);
+	}
+
+	static void DriveCharacter(AAlsCharacter& Character, const float Time, const float DeltaTime)
+	{
+		const auto SequenceTime{FMath::Fmod(Time, SequenceDuration)};
+		const auto PreviousSequenceTime{SequenceTime - DeltaTime};
+
+		const auto HasPassed{
+			[SequenceTime, PreviousSequenceTime](const float EventTime)
+			{
+				return PreviousSequenceTime < EventTime && SequenceTime >= EventTime;
+			}
+		};
+
+		// Turn the view and walk along a circle, so that view rotation and movement are replicated all the time.
+
+		auto* Controller{Character.GetController()};
+		if (IsValid(Controller))
+		{
+			auto ControlRotation{Controller->GetControlRotation()};
+			ControlRotation.Yaw = FRotator::NormalizeAxis(ControlRotation.Yaw + 45.0f * DeltaTime);
+			ControlRotation.Pitch = 10.0f * FMath::Sin(Time);
+
+			Controller->SetControlRotation(ControlRotation);
+		}
+
+		const auto MovementYawAngle{FMath::DegreesToRadians(30.0f * Time)};
+		Character.AddMovementInput({FMath::Cos(MovementYawAngle), FMath::Sin(MovementYawAngle), 0.0f});
+
+		if (HasPassed(0.0f))
+		{
+			Character.SetDesiredGait(AlsGaitTags::Running);
+			Character.SetOverlayMode(AlsOverlayModeTags::Default);
+		}
+		else if (HasPassed(3.0f))
+		{
+			Character.SetDesiredGait(AlsGaitTags::Sprinting);
+		}
+		else if (HasPassed(5.0f))
+		{
+			Character.Jump();
+		}
+		else if (HasPassed(5.5f))
+		{
+			Character.StopJumping();
+			Character.SetDesiredGait(AlsGaitTags::Walking);
+		}
+		else if (HasPassed(7.0f))
+		{
+			Character.SetDesiredStance(AlsStanceTags::Crouching);
+		}
+		else if (HasPassed(9.0f))
+		{
+			Character.SetDesiredStance(AlsStanceTags::Standing);
+			Character.SetDesiredGait(AlsGaitTags::Running);
+		}
+		else if (HasPassed(10.0f))
+		{
+			Character.StartRolling();
+		}
+		else if (HasPassed(12.0f))
+		{
+			Character.SetDesiredAiming(true);
+			Character.SetOverlayMode(AlsOverlayModeTags::Rifle);
+		}
+		else if (HasPassed(14.0f))
+		{
+			Character.SetDesiredAiming(false);
+		}
+		else if (HasPassed(15.0f))
+		{
+			Character.StartRagdolling();
+		}
+		else if (HasPassed(18.0f))
+		{
+			Character.StopRagdolling();
+		}
+	}
+
+	static void SampleSimulatedProxies(UWorld& World, FBenchmarkState& State)
+	{
+		for (TActorIterator<AAlsCharacter> Iterator{&World}; Iterator; ++Iterator)
+		{
+			auto* Character{*Iterator};
+			if (Character->GetLocalRole() != ROLE_SimulatedProxy)
+			{
+				continue;
+			}
+
+			auto& ProxyState{State.SimulatedProxies.FindOrAdd(Character)};
+			const auto bFirstSample{ProxyState.PropertyValues.IsEmpty()};
+
+			ProxyState.PropertyValues.SetNum(State.ReplicatedProperties.Num());
+
+			// Simulated proxies don't change these properties on their own, so any change was received from the server.
+
+			for (auto i{0}; i < State.ReplicatedProperties.Num(); i++)
+			{
+				const auto* Property{State.ReplicatedProperties[i]};
+
+				FString Value;
+				Property->ExportTextItem_InContainer(Value, Character, nullptr, nullptr, PPF_None);
+
+				if (!bFirstSample && ProxyState.PropertyValues[i] != Value)
+				{
+					State.ReplicatedPropertyUpdates.FindOrAdd(Property->GetFName()) += 1;
+				}
+
+				ProxyState.PropertyValues[i] = MoveTemp(Value);
+			}
+		}
+	}
+
+	static void SampleServerBandwidth(const UWorld& World, FBenchmarkState& State, const float DeltaTime)
+	{
+		const auto* NetDriver{World.GetNetDriver()};
+		if (!IsValid(NetDriver))
+		{
+			return;
+		}
+
+		// Connections only expose their bandwidth as rates that are updated once per second, so the number
+		// of sent and received bytes is estimated by integrating these rates over the benchmark frames.
+
+		for (const auto* Connection : NetDriver->ClientConnections)
+		{
+			if (IsValid(Connection))
+			{
+				State.ServerOutBytes += Connection->OutBytesPerSecond * DeltaTime;
+				State.ServerInBytes += Connection->InBytesPerSecond * DeltaTime;
+			}
+		}
+	}
+
+	static void Report(FAutomationTestBase& Test, const FBenchmarkState& State)
+	{
+		const auto Seconds{FMath::Max(UE_KINDA_SMALL_NUMBER, State.ElapsedTime)};
+		const auto CharactersCount{FMath::Max(1, State.CharactersCount)};
+
+		const auto AddLine{
+			[&Test](const FString& Line)
+			{
+				UE_LOG(LogAls, Display, TEXT("%s"), *Line);
+				Test.AddInfo(Line);
+			}
+		};
+
+		AddLine(FString::Printf(TEXT("ALS network benchmark: %d characters, %s server, %d ms latency, %d%% packet loss, %.1f s."),
+		                        State.CharactersCount, bDedicatedServer ? TEXT("dedicated") : TEXT("listen"),
+		                        Latency, PacketLoss, Seconds));
+
+		AddLine(FString::Printf(TEXT("Server out (estimated): %.1f bytes/s, %.1f bytes/s per character."),
+		                        State.ServerOutBytes / Seconds, State.ServerOutBytes / Seconds / CharactersCount));
+
+		AddLine(FString::Printf(TEXT("Server in (estimated): %.1f bytes/s, %.1f bytes/s per character."),
+		                        State.ServerInBytes / Seconds, State.ServerInBytes / Seconds / CharactersCount));
+
+		// Network events include RPCs per type and movement corrections.
+
+		auto EventCounts{FAlsNetworkEventCounters::GetCounts()};
+		EventCounts.KeySort(FNameLexicalLess{});
+
+		for (const auto& [EventName, Count] : EventCounts)
+		{
+			AddLine(FString::Printf(TEXT("Network event %s: %lld total, %.2f per second per character."),
+			                        *EventName.ToString(), Count, Count / Seconds / CharactersCount));
+		}
+
+		auto PropertyUpdates{State.ReplicatedPropertyUpdates};
+		PropertyUpdates.KeySort(FNameLexicalLess{});
+
+		const auto SimulatedProxiesCount{FMath::Max(1, State.SimulatedProxies.Num())};
+
+		for (const auto& [PropertyName, Count] : PropertyUpdates)
+		{
+			AddLine(FString::Printf(TEXT("Replicated property %s: %lld updates, %.2f per second per simulated proxy."),
+			                        *PropertyName.ToString(), Count, Count / Seconds / SimulatedProxiesCount));
+		}
+	}
+
+	class FStartCommand : public IAutomationLatentCommand
+	{
+	private:
+		TSharedRef<FBenchmarkState> State;
+
+	public:
+		explicit FStartCommand(const TSharedRef<FBenchmarkState>& State) : State{State} {}
+
+		virtual bool Update() override
+		{
+			FAlsNetworkEventCounters::Reset();
+			FAlsNetworkEventCounters::SetEnabled(true);
+
+			for (TFieldIterator<FProperty> Iterator{AAlsCharacter::StaticClass()}; Iterator; ++Iterator)
+			{
+				if (Iterator->HasAnyPropertyFlags(CPF_Net))
+				{
+					State->ReplicatedProperties.Add(*Iterator);
+				}
+			}
+
+			StartPlaySession();
+
+			State->StartTime = FPlatformTime::Seconds();
+			return true;
+		}
+	};
+
+	class FWaitForPlayersCommand : public IAutomationLatentCommand
+	{
+	private:
+		FAutomationTestBase* Test;
+
+		TSharedRef<FBenchmarkState> State;
+
+	public:
+		FWaitForPlayersCommand(FAutomationTestBase* Test, const TSharedRef<FBenchmarkState>& State) : Test{Test}, State{State} {}
+
+		virtual bool Update() override
+		{
+			if (FPlatformTime::Seconds() - State->StartTime > StartTimeout)
+			{
+				Test->AddError(TEXT("Timed out waiting for the clients to get their ALS characters. Check the benchmark map."));
+				return true;
+			}
+
+			const auto* ServerWorld{FindServerWorld()};
+			if (!IsValid(ServerWorld))
+			{
+				return false;
+			}
+
+			auto ReadyClientsCount{0};
+
+			ForEachClientWorld([&ReadyClientsCount](const UWorld& World)
+			{
+				ReadyClientsCount += IsValid(GetLocalCharacter(World)) ? 1 : 0;
+			});
+
+			if (ReadyClientsCount < ClientsCount)
+			{
+				return false;
+			}
+
+			State->CharactersCount = 0;
+
+			for (TActorIterator<AAlsCharacter> Iterator{ServerWorld}; Iterator; ++Iterator)
+			{
+				State->CharactersCount += IsValid(Iterator->GetController()) ? 1 : 0;
+			}
+
+			// Don't count the events that happened while the players were joining.
+
+			FAlsNetworkEventCounters::Reset();
+			return true;
+		}
+	};
+
+	class FRunCommand : public IAutomationLatentCommand
+	{
+	private:
+		TSharedRef<FBenchmarkState> State;
+
+	public:
+		explicit FRunCommand(const TSharedRef<FBenchmarkState>& State) : State{State} {}
+
+		virtual bool Update() override
+		{
+			auto* ServerWorld{FindServerWorld()};
+			if (!IsValid(ServerWorld))
+			{
+				return true;
+			}
+
+			const auto DeltaTime{ServerWorld->GetDeltaSeconds()};
+
+			State->ElapsedTime += DeltaTime;
+
+			auto* ServerCharacter{GetLocalCharacter(*ServerWorld)};
+			if (IsValid(ServerCharacter) && ServerWorld->GetNetMode() == NM_ListenServer)
+			{
+				DriveCharacter(*ServerCharacter, State->ElapsedTime, DeltaTime);
+			}
+
+			ForEachClientWorld([this, DeltaTime](UWorld& World)
+			{
+				auto* Character{GetLocalCharacter(World)};
+				if (IsValid(Character))
+				{
+					DriveCharacter(*Character, State->ElapsedTime, DeltaTime);
+				}
+
+				SampleSimulatedProxies(World, *State);
+			});
+
+			SampleServerBandwidth(*ServerWorld, *State, DeltaTime);
+
+			return State->ElapsedTime >= Duration;
+		}
+	};
+
+	class FReportCommand : public IAutomationLatentCommand
+	{
+	private:
+		FAutomationTestBase* Test;
+
+		TSharedRef<FBenchmarkState> State;
+
+	public:
+		FReportCommand(FAutomationTestBase* Test, const TSharedRef<FBenchmarkState>& State) : Test{Test}, State{State} {}
+
+		virtual bool Update() override
+		{
+			if (State->ElapsedTime > 0.0f)
+			{
+				Report(*Test, *State);
+			}
+
+			FAlsNetworkEventCounters::SetEnabled(false);
+			FAlsNetworkEventCounters::Reset();
+			return true;
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsNetworkBenchmarkTest, "Als.Net.Benchmark",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAlsNetworkBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsNetworkBenchmark;
+
+	if (!AutomationOpenMap(MapName))
+	{
+		AddError(FString::Printf(TEXT("Failed to load the benchmark map %s."), *MapName));
+		return false;
+	}
+
+	const auto State{MakeShared<FBenchmarkState>()};
+
+	ADD_LATENT_AUTOMATION_COMMAND(FStartCommand(State));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForPlayersCommand(this, State));
+	ADD_LATENT_AUTOMATION_COMMAND(FRunCommand(State));
+	ADD_LATENT_AUTOMATION_COMMAND(FReportCommand(this, State));
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand());
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,282 @@
+#include "Trace/AlsRewindDebuggerTrack.h"
+
+#include "IRewindDebugger.h"
+#include "State/AlsLayeringState.h"
+#include "Styling/AppStyle.h"
+#include "Trace/AlsTraceProvider.h"
+#include "TraceServices/Model/AnalysisSession.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "AlsRewindDebuggerTrack"
+
+namespace AlsRewindDebuggerTrack
+{
+	static const FAlsTraceProvider* FindProvider(const TraceServices::IAnalysisSession& Session)
+	{
+		return Session.ReadProvider<FAlsTraceProvider>(FAlsTraceProvider::ProviderName);
+	}
+
+	static FString GetShortTagName(const FAlsTraceProvider& Provider, const uint32 Id)
+	{
+		// Only the last part of the gameplay tag name is displayed, so that windows on the timeline stay readable.
+
+		const auto& TagName{Provider.GetGameplayTagName(Id)};
+
+		auto DotIndex{INDEX_NONE};
+		return TagName.FindLastChar(TEXT('.'), DotIndex) ? TagName.RightChop(DotIndex + 1) : TagName;
+	}
+
+	static FText MakeDetailsText(const FAlsTraceProvider& Provider, const FAlsTraceCharacterTimeline& Timeline,
+	                             const TArray<FName>& LayeringCurveNames, const double Time)
+	{
+		FString Text;
+
+		const auto* CharacterFrame{Timeline.FindCharacterFrame(Time)};
+		if (CharacterFrame != nullptr)
+		{
+			const auto FrameIndex{static_cast<int32>(CharacterFrame - Timeline.CharacterFrames.GetData())};
+
+			const auto FloorQueriesCount{
+				FrameIndex > 0
+					? CharacterFrame->FloorQueriesCount - Timeline.CharacterFrames[FrameIndex - 1].FloorQueriesCount
+					: 0
+			};
+
+			Text.Appendf(TEXT("Recording Time: %.3f s\n\n"), CharacterFrame->RecordingTime);
+			Text.Appendf(TEXT("Locomotion Mode: %s\n"), *Provider.GetGameplayTagName(CharacterFrame->LocomotionMode));
+			Text.Appendf(TEXT("Stance: %s\n"), *Provider.GetGameplayTagName(CharacterFrame->Stance));
+			Text.Appendf(TEXT("Gait: %s\n"), *Provider.GetGameplayTagName(CharacterFrame->Gait));
+			Text.Appendf(TEXT("Rotation Mode: %s\n"), *Provider.GetGameplayTagName(CharacterFrame->RotationMode));
+			Text.Appendf(TEXT("Locomotion Action: %s\n"), *Provider.GetGameplayTagName(CharacterFrame->LocomotionAction));
+			Text.Appendf(TEXT("Overlay Mode: %s\n"), *Provider.GetGameplayTagName(CharacterFrame->OverlayMode));
+			Text.Appendf(TEXT("Speed: %.2f cm/s\n"), CharacterFrame->Speed);
+			Text.Appendf(TEXT("Floor Queries: %d\n"), FloorQueriesCount);
+
+			// Scene queries are summed since the previous character frame, which also includes queries that are
+			// performed after the character tick, such as the camera and foot IK ones of the previous frame.
+
+			int32 SceneQueriesCounts[static_cast<int32>(EAlsTraceSceneQuerySubsystem::Count)];
+
+			Timeline.SumSceneQueries(FrameIndex > 0 ? Timeline.CharacterFrames[FrameIndex - 1].Time : -UE_DOUBLE_BIG_NUMBER,
+			                         CharacterFrame->Time, SceneQueriesCounts);
+
+			for (auto i{0}; i < static_cast<int32>(EAlsTraceSceneQuerySubsystem::Count); i++)
+			{
+				Text.Appendf(TEXT("%s Scene Queries: %d\n"),
+				             GetAlsTraceSceneQuerySubsystemName(static_cast<EAlsTraceSceneQuerySubsystem>(i)), SceneQueriesCounts[i]);
+			}
+		}
+
+		const auto* AnimationFrame{Timeline.FindAnimationFrame(Time)};
+		if (AnimationFrame != nullptr)
+		{
+			Text.Appendf(TEXT("\nFoot Left Lock Amount: %.2f\n"), AnimationFrame->FootLeftLockAmount);
+			Text.Appendf(TEXT("Foot Right Lock Amount: %.2f\n"), AnimationFrame->FootRightLockAmount);
+			Text.Appendf(TEXT("Foot Planted Amount: %.2f\n\n"), AnimationFrame->FootPlantedAmount);
+
+			for (auto i{0}; i < AnimationFrame->LayeringCurvesCount; i++)
+			{
+				// Curves traced by a different build of the plugin may not match the current layering state properties.
+
+				const auto CurveName{
+					LayeringCurveNames.IsValidIndex(i)
+						? LayeringCurveNames[i].ToString()
+						: FString::Printf(TEXT("Curve %d"), i)
+				};
+
+				Text.Appendf(TEXT("%s: %.2f\n"), *CurveName, Timeline.LayeringCurves[AnimationFrame->LayeringCurvesIndex + i]);
+			}
+		}
+
+		return FText::FromString(MoveTemp(Text));
+	}
+}
+
+FAlsRewindDebuggerTrack::FAlsRewindDebuggerTrack(const uint64 NewObjectId)
+	: ObjectId{NewObjectId}, EventData{MakeShared<SEventTimelineView::FTimelineEventData>()}
+{
+	for (TFieldIterator<FFloatProperty> Iterator{FAlsLayeringState::StaticStruct()}; Iterator; ++Iterator)
+	{
+		LayeringCurveNames.Add(Iterator->GetFName());
+	}
+}
+
+bool FAlsRewindDebuggerTrack::UpdateInternal()
+{
+	const auto* RewindDebugger{IRewindDebugger::Instance()};
+	const auto* Session{RewindDebugger->GetAnalysisSession()};
+	if (Session == nullptr)
+	{
+		return false;
+	}
+
+	TraceServices::FAnalysisSessionReadScope ReadScope{*Session};
+
+	const auto* Provider{AlsRewindDebuggerTrack::FindProvider(*Session)};
+	const auto* Timeline{Provider != nullptr ? Provider->FindTimeline(ObjectId) : nullptr};
+	if (Timeline == nullptr)
+	{
+		return false;
+	}
+
+	const auto& CharacterFrames{Timeline->CharacterFrames};
+
+	if (ProcessedCharacterFramesCount > CharacterFrames.Num())
+	{
+		// A new recording has been started, so the event data has to be built from scratch.
+
+		EventData = MakeShared<SEventTimelineView::FTimelineEventData>();
+		ProcessedCharacterFramesCount = 0;
+	}
+
+	const auto bChanged{ProcessedCharacterFramesCount < CharacterFrames.Num()};
+
+	// Only frames received since the last update are processed, so the cost
+	// of the update doesn't grow with the length of the recording.
+
+	for (; ProcessedCharacterFramesCount < CharacterFrames.Num(); ProcessedCharacterFramesCount++)
+	{
+		AppendEventData(CharacterFrames[ProcessedCharacterFramesCount],
+		                ProcessedCharacterFramesCount > 0 ? &CharacterFrames[ProcessedCharacterFramesCount - 1] : nullptr,
+		                *Provider);
+	}
+
+	DetailsText = AlsRewindDebuggerTrack::MakeDetailsText(*Provider, *Timeline, LayeringCurveNames,
+	                                                      RewindDebugger->CurrentTraceTime());
+
+	return bChanged;
+}
+
+void FAlsRewindDebuggerTrack::AppendEventData(const FAlsTraceCharacterFrame& Frame, const FAlsTraceCharacterFrame* PreviousFrame,
+                                              const FAlsTraceProvider& Provider)
+{
+	auto& Windows{EventData->Windows};
+
+	// Consecutive frames with the same locomotion mode, stance and gait are merged into a single window.
+
+	const auto bSameWindow{
+		PreviousFrame != nullptr && !Windows.IsEmpty() &&
+		PreviousFrame->LocomotionMode == Frame.LocomotionMode &&
+		PreviousFrame->Stance == Frame.Stance &&
+		PreviousFrame->Gait == Frame.Gait
+	};
+
+	if (!Windows.IsEmpty())
+	{
+		Windows.Last().TimeEnd = Frame.Time;
+	}
+
+	if (!bSameWindow)
+	{
+		auto& Window{Windows.AddDefaulted_GetRef()};
+		Window.TimeStart = Frame.Time;
+		Window.TimeEnd = Frame.Time;
+
+		Window.Description = FText::FromString(FString::Printf(TEXT("%s | %s | %s"),
+		                                                       *AlsRewindDebuggerTrack::GetShortTagName(Provider, Frame.LocomotionMode),
+		                                                       *AlsRewindDebuggerTrack::GetShortTagName(Provider, Frame.Stance),
+		                                                       *AlsRewindDebuggerTrack::GetShortTagName(Provider, Frame.Gait)));
+
+		const auto Hue{static_cast<uint8>(HashCombineFast(HashCombineFast(Frame.LocomotionMode, Frame.Stance), Frame.Gait))};
+		Window.Color = FLinearColor::MakeFromHSV8(Hue, 128, 192);
+	}
+
+	static const auto NoneId{NAME_None.GetComparisonIndex().ToUnstableInt()};
+
+	if (Frame.LocomotionAction != NoneId &&
+	    (PreviousFrame == nullptr || PreviousFrame->LocomotionAction != Frame.LocomotionAction))
+	{
+		auto& Point{EventData->Points.AddDefaulted_GetRef()};
+		Point.Time = Frame.Time;
+		Point.Description = FText::FromString(AlsRewindDebuggerTrack::GetShortTagName(Provider, Frame.LocomotionAction));
+		Point.Color = FLinearColor::White;
+	}
+}
+
+TSharedPtr<SWidget> FAlsRewindDebuggerTrack::GetTimelineViewInternal()
+{
+	return SNew(SEventTimelineView)
+		.ViewRange_Lambda([]
+		{
+			return IRewindDebugger::Instance()->GetCurrentViewRange();
+		})
+		.EventData_Lambda([this]
+		{
+			return EventData;
+		});
+}
+
+TSharedPtr<SWidget> FAlsRewindDebuggerTrack::GetDetailsViewInternal()
+{
+	return SNew(SScrollBox)
+		+ SScrollBox::Slot()
+		[
+			SNew(STextBlock)
+			.Text_Lambda([this]
+			{
+				return DetailsText;
+			})
+		];
+}
+
+FSlateIcon FAlsRewindDebuggerTrack::GetIconInternal()
+{
+	return {FAppStyle::GetAppStyleSetName(), TEXT("ClassIcon.Character")};
+}
+
+FName FAlsRewindDebuggerTrack::GetNameInternal() const
+{
+	static const FName Name{TEXTVIEW("Als")};
+	return Name;
+}
+
+FText FAlsRewindDebuggerTrack::GetDisplayNameInternal() const
+{
+	return LOCTEXT("DisplayName", "ALS");
+}
+
+uint64 FAlsRewindDebuggerTrack::GetObjectIdInternal() const
+{
+	return ObjectId;
+}
+
+FName FAlsRewindDebuggerTrackCreator::GetTargetTypeNameInternal() const
+{
+	// Class name of AAlsCharacter as it is recorded by the object trace.
+
+	static const FName TargetTypeName{TEXTVIEW("AlsCharacter")};
+	return TargetTypeName;
+}
+
+FName FAlsRewindDebuggerTrackCreator::GetNameInternal() const
+{
+	static const FName Name{TEXTVIEW("Als")};
+	return Name;
+}
+
+void FAlsRewindDebuggerTrackCreator::GetTrackTypesInternal(TArray<RewindDebugger::FRewindDebuggerTrackType>& Types) const
+{
+	Types.Add({GetNameInternal(), LOCTEXT("TrackType", "ALS")});
+}
+
+TSharedPtr<RewindDebugger::FRewindDebuggerTrack> FAlsRewindDebuggerTrackCreator::CreateTrackInternal(const uint64 ObjectId) const
+{
+	return MakeShared<FAlsRewindDebuggerTrack>(ObjectId);
+}
+
+bool FAlsRewindDebuggerTrackCreator::HasDebugInfoInternal(const uint64 ObjectId) const
+{
+	const auto* Session{IRewindDebugger::Instance()->GetAnalysisSession()};
+	if (Session == nullptr)
+	{
+		return false;
+	}
+
+	TraceServices::FAnalysisSessionReadScope ReadScope{*Session};
+
+	const auto* Provider{AlsRewindDebuggerTrack::FindProvider(*Session)};
+	return Provider != nullptr && Provider->FindTimeline(ObjectId) != nullptr;
+}
+
+#undef LOCTEXT_NAMESPACE
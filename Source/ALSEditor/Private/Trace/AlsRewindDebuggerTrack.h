@@ -0,0 +1,58 @@
+#pragma once
+
+#include "IRewindDebuggerTrackCreator.h"
+#include "RewindDebuggerTrack.h"
+#include "SEventTimelineView.h"
+
+class FAlsTraceProvider;
+struct FAlsTraceCharacterFrame;
+
+// Displays the traced ALS states of a character as timeline windows, and the values at the current time in the details view.
+class FAlsRewindDebuggerTrack : public RewindDebugger::FRewindDebuggerTrack
+{
+private:
+	uint64 ObjectId{0};
+
+	TArray<FName> LayeringCurveNames;
+
+	TSharedPtr<SEventTimelineView::FTimelineEventData> EventData;
+
+	int32 ProcessedCharacterFramesCount{0};
+
+	FText DetailsText;
+
+public:
+	explicit FAlsRewindDebuggerTrack(uint64 NewObjectId);
+
+private:
+	virtual bool UpdateInternal() override;
+
+	virtual TSharedPtr<SWidget> GetTimelineViewInternal() override;
+
+	virtual TSharedPtr<SWidget> GetDetailsViewInternal() override;
+
+	virtual FSlateIcon GetIconInternal() override;
+
+	virtual FName GetNameInternal() const override;
+
+	virtual FText GetDisplayNameInternal() const override;
+
+	virtual uint64 GetObjectIdInternal() const override;
+
+	void AppendEventData(const FAlsTraceCharacterFrame& Frame, const FAlsTraceCharacterFrame* PreviousFrame,
+	                     const FAlsTraceProvider& Provider);
+};
+
+class FAlsRewindDebuggerTrackCreator : public RewindDebugger::IRewindDebuggerTrackCreator
+{
+private:
+	virtual FName GetTargetTypeNameInternal() const override;
+
+	virtual FName GetNameInternal() const override;
+
+	virtual void GetTrackTypesInternal(TArray<RewindDebugger::FRewindDebuggerTrackType>& Types) const override;
+
+	virtual TSharedPtr<RewindDebugger::FRewindDebuggerTrack> CreateTrackInternal(uint64 ObjectId) const override;
+
+	virtual bool HasDebugInfoInternal(uint64 ObjectId) const override;
+};
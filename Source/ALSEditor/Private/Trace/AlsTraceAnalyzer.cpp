@@ -0,0 +1,84 @@
+#include "Trace/AlsTraceAnalyzer.h"
+
+#include "Trace/AlsTraceProvider.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+FAlsTraceAnalyzer::FAlsTraceAnalyzer(TraceServices::IAnalysisSession& NewSession, FAlsTraceProvider& NewProvider)
+	: Session{NewSession}, Provider{NewProvider} {}
+
+void FAlsTraceAnalyzer::OnAnalysisBegin(const FOnAnalysisContext& Context)
+{
+	auto& Builder{Context.InterfaceBuilder};
+
+	Builder.RouteEvent(RouteId_GameplayTag, "Als", "GameplayTag");
+	Builder.RouteEvent(RouteId_CharacterState, "Als", "CharacterState");
+	Builder.RouteEvent(RouteId_AnimationState, "Als", "AnimationState");
+	Builder.RouteEvent(RouteId_SceneQueries, "Als", "SceneQueries");
+}
+
+bool FAlsTraceAnalyzer::OnEvent(const uint16 RouteId, const EStyle Style, const FOnEventContext& Context)
+{
+	TraceServices::FAnalysisSessionEditScope EditScope{Session};
+
+	const auto& EventData{Context.EventData};
+
+	switch (RouteId)
+	{
+		case RouteId_GameplayTag:
+		{
+			FString Name;
+			EventData.GetString("Name", Name);
+
+			Provider.AppendGameplayTag(EventData.GetValue<uint32>("Id"), MoveTemp(Name));
+			break;
+		}
+
+		case RouteId_CharacterState:
+		{
+			FAlsTraceCharacterFrame Frame;
+			Frame.Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Frame.RecordingTime = EventData.GetValue<double>("RecordingTime");
+			Frame.LocomotionMode = EventData.GetValue<uint32>("LocomotionMode");
+			Frame.Stance = EventData.GetValue<uint32>("Stance");
+			Frame.Gait = EventData.GetValue<uint32>("Gait");
+			Frame.RotationMode = EventData.GetValue<uint32>("RotationMode");
+			Frame.LocomotionAction = EventData.GetValue<uint32>("LocomotionAction");
+			Frame.OverlayMode = EventData.GetValue<uint32>("OverlayMode");
+			Frame.Speed = EventData.GetValue<float>("Speed");
+			Frame.FloorQueriesCount = EventData.GetValue<int32>("FloorQueriesCount");
+
+			Provider.AppendCharacterState(EventData.GetValue<uint64>("CharacterId"), Frame);
+			break;
+		}
+
+		case RouteId_AnimationState:
+		{
+			FAlsTraceAnimationFrame Frame;
+			Frame.Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			Frame.RecordingTime = EventData.GetValue<double>("RecordingTime");
+			Frame.FootLeftLockAmount = EventData.GetValue<float>("FootLeftLockAmount");
+			Frame.FootRightLockAmount = EventData.GetValue<float>("FootRightLockAmount");
+			Frame.FootPlantedAmount = EventData.GetValue<float>("FootPlantedAmount");
+
+			Provider.AppendAnimationState(EventData.GetValue<uint64>("CharacterId"), Frame,
+			                              EventData.GetArrayView<float>("LayeringCurves"));
+			break;
+		}
+
+		case RouteId_SceneQueries:
+		{
+			FAlsTraceSceneQueries SceneQueries;
+			SceneQueries.Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+			SceneQueries.Subsystem = static_cast<EAlsTraceSceneQuerySubsystem>(EventData.GetValue<uint8>("Subsystem"));
+			SceneQueries.Count = EventData.GetValue<int32>("Count");
+
+			Provider.AppendSceneQueries(EventData.GetValue<uint64>("CharacterId"), SceneQueries);
+			break;
+		}
+
+		default:
+			break;
+	}
+
+	return true;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Trace/Analyzer.h"
+
+class FAlsTraceProvider;
+
+namespace TraceServices
+{
+	class IAnalysisSession;
+}
+
+class FAlsTraceAnalyzer : public UE::Trace::IAnalyzer
+{
+private:
+	enum : uint16
+	{
+		RouteId_GameplayTag,
+		RouteId_CharacterState,
+		RouteId_AnimationState,
+		RouteId_SceneQueries
+	};
+
+	TraceServices::IAnalysisSession& Session;
+
+	FAlsTraceProvider& Provider;
+
+public:
+	FAlsTraceAnalyzer(TraceServices::IAnalysisSession& NewSession, FAlsTraceProvider& NewProvider);
+
+	virtual void OnAnalysisBegin(const FOnAnalysisContext& Context) override;
+
+	virtual bool OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context) override;
+};
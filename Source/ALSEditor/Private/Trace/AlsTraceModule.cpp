@@ -0,0 +1,29 @@
+#include "Trace/AlsTraceModule.h"
+
+#include "Trace/AlsTraceAnalyzer.h"
+#include "Trace/AlsTraceProvider.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+void FAlsTraceModule::GetModuleInfo(TraceServices::FModuleInfo& ModuleInfo)
+{
+	static const FName ModuleName{TEXTVIEW("AlsTrace")};
+
+	ModuleInfo.Name = ModuleName;
+	ModuleInfo.DisplayName = TEXT("ALS");
+}
+
+void FAlsTraceModule::OnAnalysisBegin(TraceServices::IAnalysisSession& Session)
+{
+	const auto Provider{MakeShared<FAlsTraceProvider>(Session)};
+
+	Session.AddProvider(FAlsTraceProvider::ProviderName, Provider);
+	Session.AddAnalyzer(new FAlsTraceAnalyzer{Session, *Provider});
+}
+
+void FAlsTraceModule::GetLoggers(TArray<const TCHAR*>& Loggers)
+{
+	Loggers.Add(TEXT("Als"));
+}
+
+void FAlsTraceModule::GenerateReports(const TraceServices::IAnalysisSession& Session,
+                                      const TCHAR* CommandLine, const TCHAR* OutputDirectory) {}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "TraceServices/ModuleService.h"
+
+class FAlsTraceModule : public TraceServices::IModule
+{
+public:
+	virtual void GetModuleInfo(TraceServices::FModuleInfo& ModuleInfo) override;
+
+	virtual void OnAnalysisBegin(TraceServices::IAnalysisSession& Session) override;
+
+	virtual void GetLoggers(TArray<const TCHAR*>& Loggers) override;
+
+	virtual void GenerateReports(const TraceServices::IAnalysisSession& Session,
+	                             const TCHAR* CommandLine, const TCHAR* OutputDirectory) override;
+};
@@ -0,0 +1,112 @@
+#include "Trace/AlsTraceProvider.h"
+
+#include "Algo/BinarySearch.h"
+
+const FName FAlsTraceProvider::ProviderName{TEXTVIEW("AlsTraceProvider")};
+
+namespace AlsTraceProvider
+{
+	template <typename FrameType>
+	static const FrameType* FindFrame(const TArray<FrameType>& Frames, const double Time)
+	{
+		// Frames are appended in the order in which they were traced, so they are already sorted by time.
+
+		const auto Index{Algo::UpperBoundBy(Frames, Time, &FrameType::Time) - 1};
+
+		return Frames.IsValidIndex(Index) ? &Frames[Index] : nullptr;
+	}
+}
+
+const FAlsTraceCharacterFrame* FAlsTraceCharacterTimeline::FindCharacterFrame(const double Time) const
+{
+	return AlsTraceProvider::FindFrame(CharacterFrames, Time);
+}
+
+const FAlsTraceAnimationFrame* FAlsTraceCharacterTimeline::FindAnimationFrame(const double Time) const
+{
+	return AlsTraceProvider::FindFrame(AnimationFrames, Time);
+}
+
+void FAlsTraceCharacterTimeline::SumSceneQueries(const double StartTime, const double EndTime,
+                                                 int32 (&Counts)[static_cast<int32>(EAlsTraceSceneQuerySubsystem::Count)]) const
+{
+	FMemory::Memzero(Counts);
+
+	for (auto i{Algo::UpperBoundBy(SceneQueries, StartTime, &FAlsTraceSceneQueries::Time)}; i < SceneQueries.Num(); i++)
+	{
+		const auto& Queries{SceneQueries[i]};
+		if (Queries.Time > EndTime)
+		{
+			break;
+		}
+
+		if (Queries.Subsystem < EAlsTraceSceneQuerySubsystem::Count)
+		{
+			Counts[static_cast<int32>(Queries.Subsystem)] += Queries.Count;
+		}
+	}
+}
+
+FAlsTraceProvider::FAlsTraceProvider(TraceServices::IAnalysisSession& NewSession) : Session{NewSession} {}
+
+void FAlsTraceProvider::AppendGameplayTag(const uint32 Id, FString&& Name)
+{
+	Session.WriteAccessCheck();
+
+	GameplayTagNames.Emplace(Id, MoveTemp(Name));
+}
+
+void FAlsTraceProvider::AppendCharacterState(const uint64 CharacterId, const FAlsTraceCharacterFrame& Frame)
+{
+	Session.WriteAccessCheck();
+
+	Timelines.FindOrAdd(CharacterId).CharacterFrames.Add(Frame);
+
+	Session.UpdateDurationSeconds(Frame.Time);
+}
+
+void FAlsTraceProvider::AppendAnimationState(const uint64 CharacterId, FAlsTraceAnimationFrame Frame,
+                                             const TArrayView<const float> LayeringCurves)
+{
+	Session.WriteAccessCheck();
+
+	auto& Timeline{Timelines.FindOrAdd(CharacterId)};
+
+	Frame.LayeringCurvesIndex = Timeline.LayeringCurves.Num();
+	Frame.LayeringCurvesCount = LayeringCurves.Num();
+
+	Timeline.LayeringCurves.Append(LayeringCurves);
+	Timeline.AnimationFrames.Add(Frame);
+
+	Session.UpdateDurationSeconds(Frame.Time);
+}
+
+void FAlsTraceProvider::AppendSceneQueries(const uint64 CharacterId, const FAlsTraceSceneQueries& SceneQueries)
+{
+	Session.WriteAccessCheck();
+
+	// Scene queries can be traced from animation worker threads, so they may arrive slightly out of order. They
+	// are inserted by time to keep the array sorted, which usually means appending them or inserting them near the end.
+
+	auto& AllSceneQueries{Timelines.FindOrAdd(CharacterId).SceneQueries};
+	AllSceneQueries.Insert(SceneQueries, Algo::UpperBoundBy(AllSceneQueries, SceneQueries.Time, &FAlsTraceSceneQueries::Time));
+
+	Session.UpdateDurationSeconds(SceneQueries.Time);
+}
+
+const FString& FAlsTraceProvider::GetGameplayTagName(const uint32 Id) const
+{
+	Session.ReadAccessCheck();
+
+	static const FString UnknownName{TEXTVIEW("Unknown")};
+
+	const auto* Name{GameplayTagNames.Find(Id)};
+	return Name != nullptr ? *Name : UnknownName;
+}
+
+const FAlsTraceCharacterTimeline* FAlsTraceProvider::FindTimeline(const uint64 CharacterId) const
+{
+	Session.ReadAccessCheck();
+
+	return Timelines.Find(CharacterId);
+}
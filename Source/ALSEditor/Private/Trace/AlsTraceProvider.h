@@ -0,0 +1,103 @@
+#pragma once
+
+#include "TraceServices/Model/AnalysisSession.h"
+#include "Utility/AlsTrace.h"
+
+struct FAlsTraceCharacterFrame
+{
+	double Time{0.0};
+
+	double RecordingTime{0.0};
+
+	uint32 LocomotionMode{0};
+
+	uint32 Stance{0};
+
+	uint32 Gait{0};
+
+	uint32 RotationMode{0};
+
+	uint32 LocomotionAction{0};
+
+	uint32 OverlayMode{0};
+
+	float Speed{0.0f};
+
+	int32 FloorQueriesCount{0};
+};
+
+struct FAlsTraceAnimationFrame
+{
+	double Time{0.0};
+
+	double RecordingTime{0.0};
+
+	// Range of this frame's values in FAlsTraceCharacterTimeline::LayeringCurves.
+
+	int32 LayeringCurvesIndex{0};
+
+	int32 LayeringCurvesCount{0};
+
+	float FootLeftLockAmount{0.0f};
+
+	float FootRightLockAmount{0.0f};
+
+	float FootPlantedAmount{0.0f};
+};
+
+struct FAlsTraceSceneQueries
+{
+	double Time{0.0};
+
+	EAlsTraceSceneQuerySubsystem Subsystem{EAlsTraceSceneQuerySubsystem::Count};
+
+	int32 Count{0};
+};
+
+struct FAlsTraceCharacterTimeline
+{
+	TArray<FAlsTraceCharacterFrame> CharacterFrames;
+
+	TArray<FAlsTraceAnimationFrame> AnimationFrames;
+
+	TArray<float> LayeringCurves;
+
+	TArray<FAlsTraceSceneQueries> SceneQueries;
+
+public:
+	const FAlsTraceCharacterFrame* FindCharacterFrame(double Time) const;
+
+	const FAlsTraceAnimationFrame* FindAnimationFrame(double Time) const;
+
+	// Sums scene queries performed after the start time and up to and including the end time per subsystem.
+	void SumSceneQueries(double StartTime, double EndTime,
+	                     int32 (&Counts)[static_cast<int32>(EAlsTraceSceneQuerySubsystem::Count)]) const;
+};
+
+class FAlsTraceProvider : public TraceServices::IProvider
+{
+public:
+	static const FName ProviderName;
+
+private:
+	TraceServices::IAnalysisSession& Session;
+
+	TMap<uint32, FString> GameplayTagNames;
+
+	TMap<uint64, FAlsTraceCharacterTimeline> Timelines;
+
+public:
+	explicit FAlsTraceProvider(TraceServices::IAnalysisSession& NewSession);
+
+	void AppendGameplayTag(uint32 Id, FString&& Name);
+
+	void AppendCharacterState(uint64 CharacterId, const FAlsTraceCharacterFrame& Frame);
+
+	void AppendAnimationState(uint64 CharacterId, FAlsTraceAnimationFrame Frame, TArrayView<const float> LayeringCurves);
+
+	void AppendSceneQueries(uint64 CharacterId, const FAlsTraceSceneQueries& SceneQueries);
+
+	const FString& GetGameplayTagName(uint32 Id) const;
+
+	const FAlsTraceCharacterTimeline* FindTimeline(uint64 CharacterId) const;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "AlsApplyAnimationModifiersCommandlet.generated.h"
+
+// Applies animation modifiers to all animation sequences found in the specified paths. Sequences whose animation data
+// and modifier revisions haven't changed since the last run of this commandlet are skipped, unless -Force is specified.
+// Usage: -run=AlsApplyAnimationModifiers [-Paths=/Game/A+/Game/B] [-BatchSize=64] [-Force]
+UCLASS(DisplayName = "Als Apply Animation Modifiers Commandlet")
+class ALSEDITOR_API UAlsApplyAnimationModifiersCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAlsApplyAnimationModifiersCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Curves/RichCurve.h"
+
+class UAnimSequence;
+
+class ALSEDITOR_API FAlsAnimationModifierUtility
+{
+public:
+	static bool DoesFloatCurveExist(const UAnimSequence* Sequence, const FName& CurveName);
+
+	// Replaces the float curve with a new one containing the specified keys. All keys are set at once, instead of adding
+	// them one by one, each of which notifies the data model listeners and invalidates the compressed animation data.
+	static void SetFloatCurve(UAnimSequence* Sequence, const FName& CurveName, TArray<FRichCurveKey> Keys);
+
+	// Removes keys that can be restored from the remaining keys by linear interpolation or constant extrapolation
+	// within the specified tolerance, which covers constant, linear and zero value segments. Keys must be sorted by
+	// time and use linear interpolation. Returns the number of removed keys.
+	static int32 ReduceKeys(TArray<FRichCurveKey>& Keys, float Tolerance);
+
+	static void LogKeysReduction(const UAnimSequence* Sequence, int32 PreviousKeysCount, int32 NewKeysCount);
+};
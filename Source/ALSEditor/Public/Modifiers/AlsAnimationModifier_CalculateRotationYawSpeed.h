@@ -11,6 +11,15 @@ class ALSEDITOR_API UAlsAnimationModifier_CalculateRotationYawSpeed : public UAn
 {
 	GENERATED_BODY()
 
+protected:
+	// Removes keys on segments where the rotation speed is zero, constant or changes linearly.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (InlineEditConditionToggle))
+	uint8 bReduceKeys : 1 {true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings",
+		Meta = (ClampMin = 0, EditCondition = "bReduceKeys", ForceUnits = "deg/s"))
+	float KeysReductionTolerance{0.01f};
+
 public:
 	virtual void OnApply_Implementation(UAnimSequence* Sequence) override;
 };
@@ -13,9 +13,18 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	uint8 bOverrideExistingCurves : 1 {false};
 
+	// Keys added on each frame are never reduced, since the reduction would remove all but one of them.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	uint8 bAddKeyOnEachFrame : 1 {false};
 
+	// Removes keys that can be restored from the remaining keys within the tolerance, for example, keys of constant curves.
+	// Not used if keys are added on each frame.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (InlineEditConditionToggle))
+	uint8 bReduceKeys : 1 {true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, EditCondition = "bReduceKeys"))
+	float KeysReductionTolerance{0.0001f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	float CurveValue{0.0f};
 
@@ -67,5 +76,6 @@ public:
 	virtual void OnApply_Implementation(UAnimSequence* Sequence) override;
 
 private:
-	void CreateCurves(UAnimSequence* Sequence, const TArray<FName>& Names, float Value) const;
+	void CreateCurves(UAnimSequence* Sequence, const TArray<FName>& Names, float Value,
+	                  int32& PreviousKeysCount, int32& NewKeysCount) const;
 };